@@ -0,0 +1,148 @@
+#include <CD_Driver.H>
+#include <CD_Random.H>
+#include <CD_NonCommParticle.H>
+#include <CD_ParticleManagement.H>
+#include <ParmParse.H>
+
+using namespace ChomboDischarge;
+
+using PType = NonCommParticle<1, 1>;
+
+// Check that the leaves respect the leaf budget and conserve the total weight. If the budget was not used up, no leaf may be splittable
+// (same criterion as in ParticleManagement).
+void
+checkLeaves(const std::vector<Real>& a_leafWeights, const Real a_totalWeight, const int a_maxLeaves, const std::string a_method)
+{
+  const std::string baseError = "EqualWeightKD test (" + a_method + ")";
+  const int         numLeaves = a_leafWeights.size();
+
+  if (numLeaves > a_maxLeaves) {
+    MayDay::Error((baseError + " - number of leaves exceeds the leaf budget").c_str());
+  }
+
+  Real W = 0.0;
+  for (const auto& w : a_leafWeights) {
+    W += w;
+
+    if (numLeaves < a_maxLeaves && w > 2.0 - std::numeric_limits<Real>::min()) {
+      MayDay::Error((baseError + " - leaf budget was not used but a leaf could still be split").c_str());
+    }
+  }
+
+  if (W != a_totalWeight) {
+    MayDay::Error((baseError + " - total weight is not conserved").c_str());
+  }
+}
+
+int
+main(int argc, char* argv[])
+{
+#ifdef CH_MPI
+  MPI_Init(&argc, &argv);
+#endif
+
+  // Build class options from input script and command line options
+  const std::string input_file = argv[1];
+  ParmParse         pp(argc - 2, argv + 2, NULL, input_file.c_str());
+
+  int              seed;
+  int              numCells;
+  int              maxParticles;
+  int              maxWeight;
+  std::vector<int> maxLeaves;
+
+  pp.get("seed", seed);
+  pp.get("num_cells", numCells);
+  pp.get("max_particles", maxParticles);
+  pp.get("max_weight", maxWeight);
+  pp.getarr("max_leaves", maxLeaves, 0, pp.countval("max_leaves"));
+
+  Random::setSeed(seed);
+
+  for (int icell = 0; icell < numCells; icell++) {
+    RandomStream stream = Random::getStream(0, icell);
+
+    // Random particles with integer weights in a unit cell.
+    const int numParticles = 1 + std::floor(stream.uniform01() * maxParticles);
+
+    std::vector<PType> particles;
+
+    Real W = 0.0;
+    for (int i = 0; i < numParticles; i++) {
+      PType p;
+
+      p.template real<0>() = 1.0 + std::floor(stream.uniform01() * maxWeight);
+
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        p.template vect<0>()[dir] = stream.uniform01();
+      }
+
+      W += p.template real<0>();
+
+      particles.emplace_back(p);
+    }
+
+    for (const auto& numLeaves : maxLeaves) {
+
+      // KD-tree with nodes.
+      KDNode<PType>::ParticleList nodeParticles(particles);
+
+      const auto nodeLeaves =
+        ParticleManagement::recursivePartitionAndSplitEqualWeightKD<PType, &PType::template real<0>, &PType::template vect<0>>(
+          nodeParticles,
+          numLeaves);
+
+      std::vector<Real> nodeWeights;
+      for (const auto& l : nodeLeaves) {
+        Real w = 0.0;
+        for (const auto& p : l->getParticles()) {
+          w += p.template real<0>();
+        }
+
+        if (w != l->weight()) {
+          MayDay::Error("EqualWeightKD test (KDNode) - leaf weight does not match its particles");
+        }
+
+        nodeWeights.emplace_back(w);
+      }
+
+      checkLeaves(nodeWeights, W, numLeaves, "KDNode");
+
+      // KD-tree in an arena.
+      KDArena<PType> arena;
+
+      arena.getParticles() = particles;
+
+      ParticleManagement::recursivePartitionAndSplitEqualWeightKD<PType, &PType::template real<0>, &PType::template vect<0>>(arena,
+                                                                                                                               numLeaves);
+
+      std::vector<Real> arenaWeights;
+      for (const auto& l : arena.getLeaves()) {
+        Real w = 0.0;
+        for (size_t i = l.m_begin; i < l.m_end; i++) {
+          w += arena.getParticles()[i].template real<0>();
+        }
+
+        if (w != l.m_weight) {
+          MayDay::Error("EqualWeightKD test (KDArena) - leaf weight does not match its particles");
+        }
+
+        arenaWeights.emplace_back(w);
+      }
+
+      checkLeaves(arenaWeights, W, numLeaves, "KDArena");
+
+      // The two implementations must produce the same leaves.
+      if (nodeWeights != arenaWeights) {
+        MayDay::Error("EqualWeightKD test - KDNode and KDArena versions gave different leaves");
+      }
+    }
+  }
+
+#ifdef CH_MPI
+  CH_TIMER_REPORT();
+  MPI_Finalize();
+#endif
+
+  return 0;
+}
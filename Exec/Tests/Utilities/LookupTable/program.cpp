@@ -44,6 +44,52 @@ main(int argc, char* argv[])
 
   const auto interpRow = slicedTable.interpolate(std::numeric_limits<Real>::max());
 
+  // Two-dimensional table. The raw data is sampled from a bilinear function on an irregular tensor-product grid, and both
+  // the regularization and the interpolation should then reproduce the function to round-off.
+  auto bilinear = [](const Real x, const Real y) -> Real {
+    return 2.0 + 3.0 * x - y + 0.5 * x * y;
+  };
+
+  const std::vector<Real> rawX{1.0, 1.5, 3.0, 4.0, 7.0};
+  const std::vector<Real> rawY{0.0, 2.0, 2.5, 5.0};
+
+  LookupTable2D<Real> table2D;
+  for (const auto& x : rawX) {
+    for (const auto& y : rawY) {
+      table2D.addData(x, y, bilinear(x, y));
+    }
+  }
+
+  table2D.prepareTable(32, LookupTable::Spacing::Uniform, 16, LookupTable::Spacing::Uniform);
+
+  constexpr int  numSamples = 50;
+  constexpr Real tolerance  = 1.E-10;
+
+  std::vector<Real> sampleX;
+  std::vector<Real> sampleY;
+  for (int i = 0; i < numSamples; i++) {
+    for (int j = 0; j < numSamples; j++) {
+      sampleX.emplace_back(1.0 + (6.0 * i) / (numSamples - 1));
+      sampleY.emplace_back((5.0 * j) / (numSamples - 1));
+    }
+  }
+
+  for (const auto& interpolation : {LookupTable::Interpolation::Linear, LookupTable::Interpolation::Cubic}) {
+    table2D.setInterpolation(interpolation);
+
+    std::vector<Real> batch(sampleX.size());
+    table2D.interpolate(batch.data(), sampleX.data(), sampleY.data(), sampleX.size());
+
+    for (size_t i = 0; i < sampleX.size(); i++) {
+      const Real exact = bilinear(sampleX[i], sampleY[i]);
+      const Real value = table2D.interpolate(sampleX[i], sampleY[i]);
+
+      if (std::abs(value - exact) > tolerance * std::abs(exact) || batch[i] != value) {
+        MayDay::Error("LookupTable test - LookupTable2D does not reproduce the bilinear function");
+      }
+    }
+  }
+
 #ifdef CH_MPI
   CH_TIMER_REPORT();
   MPI_Finalize();
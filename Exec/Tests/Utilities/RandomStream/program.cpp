@@ -0,0 +1,91 @@
+#include <CD_Driver.H>
+#include <CD_Random.H>
+#include <ParmParse.H>
+
+using namespace ChomboDischarge;
+
+// Draw a sequence of numbers from the stream (step, id) using all the stream functions.
+std::vector<Real>
+drawSequence(const uint64_t a_step, const uint64_t a_id, const int a_numDraws)
+{
+  RandomStream stream = Random::getStream(a_step, a_id);
+
+  std::vector<Real> ret;
+  for (int i = 0; i < a_numDraws; i++) {
+    ret.emplace_back(stream.uniform01());
+    ret.emplace_back(stream.uniform11());
+    ret.emplace_back(stream.normal01());
+    ret.emplace_back((Real)stream.poisson<long long>(0.5 + i));
+
+    const RealVect direction = stream.direction();
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      ret.emplace_back(direction[dir]);
+    }
+  }
+
+  std::vector<Real> batch(a_numDraws);
+
+  stream.fillUniform01(batch.data(), batch.size());
+  ret.insert(ret.end(), batch.begin(), batch.end());
+
+  stream.fillNormal01(batch.data(), batch.size());
+  ret.insert(ret.end(), batch.begin(), batch.end());
+
+  return ret;
+}
+
+int
+main(int argc, char* argv[])
+{
+#ifdef CH_MPI
+  MPI_Init(&argc, &argv);
+#endif
+
+  // Build class options from input script and command line options
+  const std::string input_file = argv[1];
+  ParmParse         pp(argc - 2, argv + 2, NULL, input_file.c_str());
+
+  int seed;
+  int numDraws;
+
+  pp.get("seed", seed);
+  pp.get("num_draws", numDraws);
+
+  // Two runs with the same seed must give identical sequences.
+  Random::setSeed(seed);
+  const std::vector<Real> firstRun = drawSequence(3, 7, numDraws);
+
+  Random::setSeed(seed);
+  const std::vector<Real> secondRun = drawSequence(3, 7, numDraws);
+
+  if (firstRun != secondRun) {
+    MayDay::Error("RandomStream test - two runs with the same seed gave different sequences");
+  }
+
+  // Streams with a different seed, step, or id must give different sequences.
+  if (drawSequence(3, 8, numDraws) == firstRun || drawSequence(4, 7, numDraws) == firstRun) {
+    MayDay::Error("RandomStream test - different streams gave the same sequence");
+  }
+
+  Random::setSeed(seed + 1);
+  if (drawSequence(3, 7, numDraws) == firstRun) {
+    MayDay::Error("RandomStream test - different seeds gave the same sequence");
+  }
+
+  // The streams are keyed by the global seed, so all ranks must draw the same sequence.
+#ifdef CH_MPI
+  std::vector<Real> masterRun(firstRun);
+  MPI_Bcast(masterRun.data(), masterRun.size(), MPI_CH_REAL, 0, Chombo_MPI::comm);
+
+  if (masterRun != firstRun) {
+    MayDay::Error("RandomStream test - sequence depends on the MPI rank");
+  }
+#endif
+
+#ifdef CH_MPI
+  CH_TIMER_REPORT();
+  MPI_Finalize();
+#endif
+
+  return 0;
+}
@@ -174,11 +174,14 @@ CdrPlasmaStepper::computeCellConductivity(EBAMRCellData& a_cellConductivity) con
   const EBAMRCellData cellCenteredElectricField = m_amr->alias(m_phase, m_fieldSolver->getElectricField());
 
   // Allocate some storage for holding the electric field magnitude and one species conductivity.
-  EBAMRCellData fieldMagnitude;
-  EBAMRCellData speciesConductivity;
+  EBAMRCellLease fieldMagnitudeLease;
+  EBAMRCellLease speciesConductivityLease;
 
-  m_amr->allocate(fieldMagnitude, m_realm, m_phase, 1);
-  m_amr->allocate(speciesConductivity, m_realm, m_phase, 1);
+  m_amr->leaseScratch(fieldMagnitudeLease, m_realm, m_phase, 1);
+  m_amr->leaseScratch(speciesConductivityLease, m_realm, m_phase, 1);
+
+  EBAMRCellData& fieldMagnitude      = *fieldMagnitudeLease;
+  EBAMRCellData& speciesConductivity = *speciesConductivityLease;
 
   // Compute the electric field magnitude
   DataOps::vectorLength(fieldMagnitude, cellCenteredElectricField);
@@ -2780,13 +2783,17 @@ CdrPlasmaStepper::computeExtrapolatedFluxes(Vector<EBAMRIVData*>&        a_extra
   // F = v_extrap*Max(0.0, phi_extrap) since we expect v to be "smooth" and phi_extrap to be a noisy bastard
 
   // Allocate some data holders we can use for holding the fluxes.
-  EBAMRIVData ebFlux;
-  EBAMRIVData ebVel;
-  EBAMRIVData ebPhi;
+  EBAMRIVLease ebFluxLease;
+  EBAMRIVLease ebVelLease;
+  EBAMRIVLease ebPhiLease;
+
+  m_amr->leaseScratch(ebFluxLease, m_realm, a_phase, SpaceDim);
+  m_amr->leaseScratch(ebVelLease, m_realm, a_phase, SpaceDim);
+  m_amr->leaseScratch(ebPhiLease, m_realm, a_phase, 1);
 
-  m_amr->allocate(ebFlux, m_realm, a_phase, SpaceDim);
-  m_amr->allocate(ebVel, m_realm, a_phase, SpaceDim);
-  m_amr->allocate(ebPhi, m_realm, a_phase, 1);
+  EBAMRIVData& ebFlux = *ebFluxLease;
+  EBAMRIVData& ebVel  = *ebVelLease;
+  EBAMRIVData& ebPhi  = *ebPhiLease;
 
   // This stencil takes cell centered data and puts it on the centroid.
   const IrregAmrStencil<EbCentroidInterpolationStencil>& interpStencils = m_amr->getEbCentroidInterpolationStencils(
@@ -2896,8 +2903,10 @@ CdrPlasmaStepper::computeExtrapolatedVelocities(Vector<EBAMRIVData*>&        a_c
   CH_assert(a_cdrVelocitiesCell.size() == numCdrSolvers);
 
   // Allocate some scratch data -- it is used for extrapolating the vell-centered data to the EB.
-  EBAMRIVData scratch;
-  m_amr->allocate(scratch, m_realm, a_phase, SpaceDim);
+  EBAMRIVLease scratchLease;
+  m_amr->leaseScratch(scratchLease, m_realm, a_phase, SpaceDim);
+
+  EBAMRIVData& scratch = *scratchLease;
 
   //  for (int i = 0; i < a_cdrVelocitiesEB.size(); i++){
   for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
@@ -4478,11 +4487,14 @@ CdrPlasmaStepper::computeRelaxationTime()
   // TLDR: This computes the relaxation time as t = eps0/conductivity. Simple as that.
 
   // Allocate some data that can hold the conductivity and eps0/conductivity.
-  EBAMRCellData relaxTime;
-  EBAMRCellData conductivity;
+  EBAMRCellLease relaxTimeLease;
+  EBAMRCellLease conductivityLease;
+
+  m_amr->leaseScratch(relaxTimeLease, m_realm, phase::gas, 1);
+  m_amr->leaseScratch(conductivityLease, m_realm, phase::gas, 1);
 
-  m_amr->allocate(relaxTime, m_realm, phase::gas, 1);
-  m_amr->allocate(conductivity, m_realm, phase::gas, 1);
+  EBAMRCellData& relaxTime    = *relaxTimeLease;
+  EBAMRCellData& conductivity = *conductivityLease;
 
   // Compute the conductivity.
   this->computeCellConductivity(conductivity);
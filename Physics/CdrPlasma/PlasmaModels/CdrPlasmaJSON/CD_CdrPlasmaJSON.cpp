@@ -1319,10 +1319,10 @@ CdrPlasmaJSON::parseAlpha()
     // Read the table and format it. We happen to know that this function reads data into the approprate columns. So if
     // the user specified the correct E/N column then that data will be put in the first column. The data for mu*N will be in the
     // second column.
-    m_alphaTableEN = DataParser::fractionalFileReadASCII(filename, startRead, stopRead, xColumn, yColumn);
+    LookupTable1D<Real, 1> alphaTable = DataParser::fractionalFileReadASCII(filename, startRead, stopRead, xColumn, yColumn);
 
     // If the table is empty then it's an error.
-    if (m_alphaTableEN.getRawData().size() <= 1) {
+    if (alphaTable.getRawData().size() <= 1) {
       this->throwParserError(baseError + " and got 'table E/N' but table is empty. This is probably an error");
     }
 
@@ -1340,16 +1340,17 @@ CdrPlasmaJSON::parseAlpha()
     }
 
     // Format the table
-    m_alphaTableEN.truncate(minEN, maxEN, 0);
-    m_alphaTableEN.prepareTable(0, numPoints, tableSpacing);
+    alphaTable.truncate(minEN, maxEN, 0);
+    alphaTable.prepareTable(0, numPoints, tableSpacing);
 
     // Check if we should dump the table to file so that users can debug.
     if (alpha.contains("dump")) {
       const std::string dumpFile = alpha["dump"].get<std::string>();
-      m_alphaTableEN.writeStructuredData(dumpFile);
+      alphaTable.writeStructuredData(dumpFile);
     }
 
-    m_alphaLookup = LookupMethod::TableEN;
+    m_alphaColumnEN = m_tablesEN.addTable(alphaTable);
+    m_alphaLookup   = LookupMethod::TableEN;
   }
   else if (lookup == "morrow-lowke") {
 
@@ -1471,10 +1472,10 @@ CdrPlasmaJSON::parseEta()
     // Read the table and format it. We happen to know that this function reads data into the approprate columns. So if
     // the user specified the correct E/N column then that data will be put in the first column. The data for mu*N will be in the
     // second column.
-    m_etaTableEN = DataParser::fractionalFileReadASCII(filename, startRead, stopRead, xColumn, yColumn);
+    LookupTable1D<Real, 1> etaTable = DataParser::fractionalFileReadASCII(filename, startRead, stopRead, xColumn, yColumn);
 
     // If the table is empty then it's an error.
-    if (m_etaTableEN.getRawData().size() == 0) {
+    if (etaTable.getRawData().size() == 0) {
       this->throwParserError(baseError + " and got 'table E/N' but table is empty. This is probably an error");
     }
 
@@ -1492,16 +1493,17 @@ CdrPlasmaJSON::parseEta()
     }
 
     // Format the table
-    m_etaTableEN.truncate(minEN, maxEN, 0);
-    m_etaTableEN.prepareTable(0, numPoints, tableSpacing);
+    etaTable.truncate(minEN, maxEN, 0);
+    etaTable.prepareTable(0, numPoints, tableSpacing);
 
     // Check if we should dump the table to file so that users can debug.
     if (eta.contains("dump")) {
       const std::string dumpFile = eta["dump"].get<std::string>();
-      m_etaTableEN.writeStructuredData(dumpFile);
+      etaTable.writeStructuredData(dumpFile);
     }
 
-    m_etaLookup = LookupMethod::TableEN;
+    m_etaColumnEN = m_tablesEN.addTable(etaTable);
+    m_etaLookup   = LookupMethod::TableEN;
   }
   else if (lookup == "morrow-lowke") {
 
@@ -1669,7 +1671,7 @@ CdrPlasmaJSON::parseMobilities()
 
         // Ok, put the table where it belongs.
         m_mobilityLookup.emplace(std::make_pair(idx, LookupMethod::TableEN));
-        m_mobilityTablesEN.emplace(std::make_pair(idx, mobilityTable));
+        m_mobilityColumnsEN.emplace(std::make_pair(idx, m_tablesEN.addTable(mobilityTable)));
       }
       else if (lookup == "table energy") {
         if (!(mobilityJSON.contains("file")))
@@ -1981,7 +1983,7 @@ CdrPlasmaJSON::parseDiffusion()
         }
 
         m_diffusionLookup.emplace(std::make_pair(idx, LookupMethod::TableEN));
-        m_diffusionTablesEN.emplace(std::make_pair(idx, diffusionTable));
+        m_diffusionColumnsEN.emplace(std::make_pair(idx, m_tablesEN.addTable(diffusionTable)));
       }
       else if (lookup == "table energy") {
         if (!(diffusionJSON.contains("file")))
@@ -2271,7 +2273,7 @@ CdrPlasmaJSON::parseTemperatures()
         }
 
         m_temperatureLookup.emplace(std::make_pair(idx, LookupMethod::TableEN));
-        m_temperatureTablesEN.emplace(std::make_pair(idx, temperatureTable));
+        m_temperatureColumnsEN.emplace(std::make_pair(idx, m_tablesEN.addTable(temperatureTable)));
       }
       else {
         this->throwParserError(baseError + " -- logic bust");
@@ -2810,7 +2812,7 @@ CdrPlasmaJSON::parsePlasmaReactionRate(const int a_reactionIndex, const json& a_
 
     // Add the tabulated rate and identifier.
     m_plasmaReactionLookup.emplace(std::make_pair(a_reactionIndex, LookupMethod::TableEN));
-    m_plasmaReactionTablesEN.emplace(std::make_pair(a_reactionIndex, reactionTable));
+    m_plasmaReactionColumnsEN.emplace(std::make_pair(a_reactionIndex, m_tablesEN.addTable(reactionTable)));
   }
   else if (lookup == "table energy") {
     if (!(a_R.contains("file")))
@@ -4365,6 +4367,9 @@ CdrPlasmaJSON::computePlasmaSpeciesMobilities(const RealVect&          a_positio
 
   const std::vector<Real> energies = this->computePlasmaSpeciesEnergies(a_position, a_E, a_cdrDensities);
 
+  // Evaluate all the E/N tables in this cell at once. Species with tabulated mobilities fetch their column from these.
+  const std::vector<Real>& tablesEN = m_tablesEN.evaluate(Etd);
+
   // vector of mobilities
   std::vector<Real> mu(m_numCdrSpecies, 0.0);
 
@@ -4395,10 +4400,8 @@ CdrPlasmaJSON::computePlasmaSpeciesMobilities(const RealVect&          a_positio
       }
       case LookupMethod::TableEN: {
         // Recall; the mobility tables are stored as (E/N, mu*N) so we need to extract mu from that.
-        const LookupTable1D<Real,1>& mobilityTable = m_mobilityTablesEN.at(i);
-
-        mu[i] = mobilityTable.interpolate<1>(Etd); // Get mu*N
-        mu[i] /= N;                             // Get mu
+        mu[i] = tablesEN[m_tablesEN.getColumnIndex(m_mobilityColumnsEN.at(i))]; // Get mu*N
+        mu[i] /= N;                                                              // Get mu
 
         break;
       }
@@ -4446,6 +4449,9 @@ CdrPlasmaJSON::computePlasmaSpeciesDiffusion(const RealVect          a_pos,
   // Compute the species energies. We might need them.
   const std::vector<Real> energies = this->computePlasmaSpeciesEnergies(a_pos, a_E, a_cdrDensities);
 
+  // Evaluate all the E/N tables in this cell at once.
+  const std::vector<Real>& tablesEN = m_tablesEN.evaluate(Etd);
+
   for (int i = 0; i < a_cdrDensities.size(); i++) {
     const bool isDiffusive    = m_cdrSpecies[i]->isDiffusive();
     const bool isEnergySolver = m_cdrIsEnergySolver.at(i);
@@ -4470,10 +4476,8 @@ CdrPlasmaJSON::computePlasmaSpeciesDiffusion(const RealVect          a_pos,
       }
       case LookupMethod::TableEN: {
         // Recall; the diffusion tables are stored as (E/N, D*N) so we need to extract D from that.
-        const LookupTable1D<Real, 1>& diffusionTable = m_diffusionTablesEN.at(i);
-
-        Dco = diffusionTable.interpolate<1>(Etd); // Get D*N
-        Dco /= N;                              // Get D
+        Dco = tablesEN[m_tablesEN.getColumnIndex(m_diffusionColumnsEN.at(i))]; // Get D*N
+        Dco /= N;                                                               // Get D
 
         break;
       }
@@ -4542,6 +4546,9 @@ CdrPlasmaJSON::computePlasmaSpeciesEnergies(const RealVect&          a_position,
   const Real E   = a_E.vectorLength();
   const Real Etd = (E / (N * Units::Td));
 
+  // Evaluate all the E/N tables in this cell at once.
+  const std::vector<Real>& tablesEN = m_tablesEN.evaluate(Etd);
+
   // Return vector of temperatures.
   std::vector<Real> energies(m_numCdrSpecies, 0.0);
 
@@ -4582,9 +4589,7 @@ CdrPlasmaJSON::computePlasmaSpeciesEnergies(const RealVect&          a_position,
         }
         case LookupMethod::TableEN: {
           // Recall; the temperature tables are stored as (E/N, K) so we can fetch the temperature immediately.
-          const LookupTable1D<Real, 1>& temperatureTable = m_temperatureTablesEN.at(i);
-
-          T = temperatureTable.interpolate<1>(Etd);
+          T = tablesEN[m_tablesEN.getColumnIndex(m_temperatureColumnsEN.at(i))];
 
           break;
         }
@@ -4662,10 +4667,8 @@ CdrPlasmaJSON::computePlasmaReactionRate(const int&                   a_reaction
   }
   case LookupMethod::TableEN: {
     // Recall; the reaction tables are stored as (E/N, rate/N) so we need to extract mu from that.
-    const LookupTable1D<Real, 1>& reactionTable = m_plasmaReactionTablesEN.at(a_reactionIndex);
-
     // Get the reaction rate.
-    k = reactionTable.interpolate<1>(a_Etd);
+    k = m_tablesEN.interpolate(m_plasmaReactionColumnsEN.at(a_reactionIndex), a_Etd);
 
     // Multiply by neutral species densities.
     for (const auto& n : neutralReactants) {
@@ -4788,8 +4791,8 @@ CdrPlasmaJSON::computeAlpha(const Real a_E, const RealVect a_position) const
 
   switch (m_alphaLookup) {
   case LookupMethod::TableEN: {
-    alpha = m_alphaTableEN.interpolate<1>(Etd); // Get alpha/N
-    alpha *= N;                              // Get alpha
+    alpha = m_tablesEN.interpolate(m_alphaColumnEN, Etd); // Get alpha/N
+    alpha *= N;                                           // Get alpha
 
     break;
   }
@@ -4823,8 +4826,8 @@ CdrPlasmaJSON::computeEta(const Real a_E, const RealVect a_position) const
     break;
   }
   case LookupMethod::TableEN: {
-    eta = m_etaTableEN.interpolate<1>(Etd); // Get eta/N
-    eta *= N;                            // Get eta
+    eta = m_tablesEN.interpolate(m_etaColumnEN, Etd); // Get eta/N
+    eta *= N;                                         // Get eta
 
     break;
   }
@@ -24,6 +24,8 @@
 #include <CD_NamespaceHeader.H>
 
 using namespace Physics::CdrPlasma;
+using DataOpsExpression::max;
+using DataOpsExpression::ref;
 
 typedef CdrPlasmaGodunovStepper::CdrStorage   CdrStorage;
 typedef CdrPlasmaGodunovStepper::FieldStorage FieldStorage;
@@ -1235,8 +1237,7 @@ CdrPlasmaGodunovStepper::advanceTransportExplicitField(const Real a_dt)
         solver->computeDivF(scratch2, phi, 0.0, false, true, true);
 
         // Make phi = phi^k + 0.5*dt * (scratch1 + scratch2)
-        DataOps::incr(phi, scratch, 0.5 * a_dt);
-        DataOps::incr(phi, scratch2, -0.5 * a_dt);
+        DataOps::eval(phi, ref(phi) + (0.5 * a_dt) * ref(scratch) - (0.5 * a_dt) * ref(scratch2));
 
         break;
       }
@@ -1289,8 +1290,7 @@ CdrPlasmaGodunovStepper::advanceTransportExplicitField(const Real a_dt)
 
           solver->computeDivD(scratch2, phi, false, false, false);
 
-          DataOps::incr(phi, scratch, -0.5 * a_dt);
-          DataOps::incr(phi, scratch2, 0.5 * a_dt);
+          DataOps::eval(phi, ref(phi) - (0.5 * a_dt) * ref(scratch) + (0.5 * a_dt) * ref(scratch2));
         }
       }
     }
@@ -1325,8 +1325,7 @@ CdrPlasmaGodunovStepper::advanceTransportSemiImplicit(const Real a_dt)
   // Compute the conductivity first. We store it as sigma^k*a_dt/eps0
   m_timer->startEvent("Compute conductivity");
   this->computeCellConductivity(m_conductivityFactorCell);
-  DataOps::scale(m_conductivityFactorCell, a_dt / Units::eps0);
-  DataOps::floor(m_conductivityFactorCell, 0.0);
+  DataOps::eval(m_conductivityFactorCell, max((a_dt / Units::eps0) * ref(m_conductivityFactorCell), 0.0));
 
   m_amr->arithmeticAverage(m_conductivityFactorCell, m_realm, m_phase);
   m_amr->interpGhostPwl(m_conductivityFactorCell, m_realm, m_phase);
@@ -1406,11 +1405,15 @@ CdrPlasmaGodunovStepper::advanceCdrReactions(const Real a_dt)
     EBAMRCellData&       phi = solver->getPhi();
     const EBAMRCellData& src = solver->getSource();
 
-    DataOps::incr(phi, src, a_dt);
+    // Floor mass if asked for it. If running in debug mode we compute the mass before and after flooring it. Otherwise the
+    // update and the floor are fused into a single pass over the data.
+    if (m_floor && !m_debug) {
+      DataOps::eval(phi, max(ref(phi) + a_dt * ref(src), 0.0));
+    }
+    else {
+      DataOps::eval(phi, ref(phi) + a_dt * ref(src));
 
-    // Floor mass if asked for it. If running in debug mode we compute the mass before and after flooring it.
-    if (m_floor) {
-      if (m_debug) {
+      if (m_floor) {
         const Real massBefore = solver->computeMass();
 
         DataOps::floor(phi, 0.0);
@@ -1421,9 +1424,6 @@ CdrPlasmaGodunovStepper::advanceCdrReactions(const Real a_dt)
         pout() << "CdrPlasmaGodunovStepper::advanceCdrReactions - injecting relative " << solver->getName()
                << " mass = " << relMassDiff << endl;
       }
-      else {
-        DataOps::floor(phi, 0.0);
-      }
     }
   }
 }
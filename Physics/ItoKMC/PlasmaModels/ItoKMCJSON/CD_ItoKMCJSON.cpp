@@ -688,13 +688,13 @@ ItoKMCJSON::initializeTownsendCoefficient(const std::string a_coeff)
       this->throwParserError(baseErrorTable + "but 'file' is not specified");
     }
 
-    LookupTable1D<Real, 1> tabulatedCoeff = this->parseTableEByN(jsonTable, a_coeff + "/N");
+    const auto column = m_tablesEN.addTable(this->parseTableEByN(jsonTable, a_coeff + "/N"));
 
-    func = [this, tabulatedCoeff](const Real E, const RealVect x) -> Real {
+    func = [this, column](const Real E, const RealVect x) -> Real {
       const Real N   = m_gasNumberDensity(x);
       const Real Etd = E / (N * Units::Td);
 
-      return tabulatedCoeff.interpolate<1>(Etd) * N;
+      return m_tablesEN.interpolate(column, Etd) * N;
     };
   }
   else if (type == "auto") {
@@ -1189,15 +1189,44 @@ ItoKMCJSON::initializeParticles()
             wcol = jsonEntry["w column"].get<unsigned int>();
           }
 
-          List<PointParticle> particles = DataParser::readPointParticlesASCII(f, xcol, ycol, zcol, wcol);
+          std::string format = "ascii";
+          if (jsonEntry.contains("format")) {
+            format = this->trim(jsonEntry["format"].get<std::string>());
+          }
 
-#ifdef CH_MPI
-          if (procID() == 0) {
-            initialParticles.catenate(particles);
+          // Each rank obtains a disjoint subset of the particles in the file. The particles are routed to the ranks that own them
+          // when they are added to the solvers' particle containers.
+          List<PointParticle> particles;
+
+          if (format == "ascii") {
+            particles = DataParser::scatterPointParticlesASCII(f, xcol, ycol, zcol, wcol);
+          }
+          else if (format == "binary") {
+            if (!(jsonEntry.contains("num columns"))) {
+              this->throwParserError(baseError + " but 'list' with 'binary' format does not contain 'num columns'");
+            }
+
+            const unsigned int numColumns = jsonEntry["num columns"].get<unsigned int>();
+
+            particles = DataParser::readPointParticlesBinary(f, numColumns, xcol, ycol, zcol, wcol);
           }
+          else if (format == "hdf5") {
+#ifdef CH_USE_HDF5
+            std::string dataSet = "particles";
+            if (jsonEntry.contains("dataset")) {
+              dataSet = this->trim(jsonEntry["dataset"].get<std::string>());
+            }
+
+            particles = DataParser::readPointParticlesHDF5(f, dataSet, xcol, ycol, zcol, wcol);
 #else
-          initialParticles.catenate(particles);
+            this->throwParserError(baseError + " but 'list' with 'hdf5' format requires compilation with HDF5");
 #endif
+          }
+          else {
+            this->throwParserError(baseError + " but 'list' got unsupported format '" + format + "'");
+          }
+
+          initialParticles.catenate(particles);
         }
         else {
           this->throwParserError(baseError + " but specification '" + whichField + "' is not supported");
@@ -1317,13 +1346,13 @@ ItoKMCJSON::initializeMobilities()
           this->throwParserError(baseErrorTable + ", but 'file' is not specified");
         }
 
-        LookupTable1D<Real, 1> tabulatedCoeff = this->parseTableEByN(mobilityJSON, "mu*N");
+        const auto column = m_tablesEN.addTable(this->parseTableEByN(mobilityJSON, "mu*N"));
 
-        mobilityFunction = [this, tabulatedCoeff](const Real E, const RealVect x) -> Real {
+        mobilityFunction = [this, column](const Real E, const RealVect x) -> Real {
           const Real N   = m_gasNumberDensity(x);
           const Real Etd = E / (N * Units::Td);
 
-          return tabulatedCoeff.interpolate<1>(Etd) / (std::numeric_limits<Real>::epsilon() + N);
+          return m_tablesEN.interpolate(column, Etd) / (std::numeric_limits<Real>::epsilon() + N);
         };
       }
       else {
@@ -1412,13 +1441,13 @@ ItoKMCJSON::initializeDiffusionCoefficients()
           this->throwParserError(baseErrorTable + ", but 'file' is not specified");
         }
 
-        LookupTable1D<Real, 1> tabulatedCoeff = this->parseTableEByN(diffusionJSON, "D*N");
+        const auto column = m_tablesEN.addTable(this->parseTableEByN(diffusionJSON, "D*N"));
 
-        diffusionCoefficient = [this, tabulatedCoeff](const Real E, const RealVect x) -> Real {
+        diffusionCoefficient = [this, column](const Real E, const RealVect x) -> Real {
           const Real N   = m_gasNumberDensity(x);
           const Real Etd = E / (N * Units::Td);
 
-          return tabulatedCoeff.interpolate<1>(Etd) / (std::numeric_limits<Real>::epsilon() + N);
+          return m_tablesEN.interpolate(column, Etd) / (std::numeric_limits<Real>::epsilon() + N);
         };
       }
       else {
@@ -1489,15 +1518,15 @@ ItoKMCJSON::initializeTemperatures()
           this->throwParserError(baseErrorTable + ", but 'file' is not specified");
         }
 
-        LookupTable1D<Real, 1> tabulatedCoeff = this->parseTableEByN(temperatureJSON, "eV");
+        const auto column = m_tablesEN.addTable(this->parseTableEByN(temperatureJSON, "eV"));
 
         constexpr Real eVToKelvin = 2.0 * Units::Qe / (3.0 * Units::kb);
 
-        temperature = [this, eVToKelvin, tabulatedCoeff](const Real E, const RealVect x) -> Real {
+        temperature = [this, eVToKelvin, column](const Real E, const RealVect x) -> Real {
           const Real N   = m_gasNumberDensity(x);
           const Real Etd = E / (N * Units::Td);
 
-          return eVToKelvin * tabulatedCoeff.interpolate<1>(Etd) / (std::numeric_limits<Real>::epsilon() + N);
+          return eVToKelvin * m_tablesEN.interpolate(column, Etd) / (std::numeric_limits<Real>::epsilon() + N);
         };
       }
       else {
@@ -2309,7 +2338,7 @@ std::pair<std::function<Real(const Real E, const Real V, const RealVect x)>,
           std::function<Real(const Real E, const RealVect x)>>
 ItoKMCJSON::parsePlasmaReactionRate(const nlohmann::json&    a_reactionJSON,
                                     const std::list<size_t>& a_backgroundReactants,
-                                    const std::list<size_t>& a_plasmaReactants) const
+                                    const std::list<size_t>& a_plasmaReactants)
 {
   CH_TIME("ItoKMCJSON::parsePlasmaReactionRate");
   if (m_verbose) {
@@ -2418,12 +2447,29 @@ ItoKMCJSON::parsePlasmaReactionRate(const nlohmann::json&    a_reactionJSON,
       this->throwParserError(baseErrorTable + "but 'file' is not specified");
     }
 
-    LookupTable1D<Real, 1> tabulatedCoeff = this->parseTableEByN(a_reactionJSON, "rate/N");
+    const auto column = m_tablesEN.addTable(this->parseTableEByN(a_reactionJSON, "rate/N"));
 
-    fluidRate = [&N = this->m_gasNumberDensity, tabulatedCoeff](const Real E, const RealVect x) -> Real {
-      const Real Etd = E / (N(x) * Units::Td);
+    fluidRate = [this, column](const Real E, const RealVect x) -> Real {
+      const Real Etd = E / (m_gasNumberDensity(x) * Units::Td);
 
-      return tabulatedCoeff.interpolate<1>(Etd);
+      return m_tablesEN.interpolate(column, Etd);
+    };
+  }
+  else if (type == "table vs E/N and N") {
+    const std::string baseErrorTable = baseError + " and got table vs E/N and N";
+
+    // Read in the table.
+    if (!(a_reactionJSON.contains("file"))) {
+      this->throwParserError(baseErrorTable + "but 'file' is not specified");
+    }
+
+    const LookupTable2D<Real> tabulatedCoeff = this->parseTableEByNAndN(a_reactionJSON, "rate/N");
+
+    fluidRate = [this, tabulatedCoeff](const Real E, const RealVect x) -> Real {
+      const Real N   = m_gasNumberDensity(x);
+      const Real Etd = E / (N * Units::Td);
+
+      return tabulatedCoeff.interpolate(Etd, N);
     };
   }
   else if (type == "function T A") {
@@ -2845,6 +2891,153 @@ ItoKMCJSON::parseTableEByN(const nlohmann::json& a_tableEntry, const std::string
   return tabulatedCoefficient;
 }
 
+LookupTable2D<Real>
+ItoKMCJSON::parseTableEByNAndN(const nlohmann::json& a_tableEntry, const std::string& a_dataID) const
+{
+  CH_TIME("ItoKMCJSON::parseTableEByNAndN");
+  if (m_verbose) {
+    pout() << m_className + "::parseTableEByNAndN" << endl;
+  }
+
+  const std::string preError  = "ItoKMCJSON::parseTableEByNAndN";
+  const std::string postError = "for dataID = " + a_dataID;
+
+  if (!(a_tableEntry.contains("file"))) {
+    this->throwParserError(preError + " but could not find the 'file' specifier " + postError);
+  }
+
+  const std::string fileName = this->trim(a_tableEntry["file"].get<std::string>());
+  if (!(this->doesFileExist(fileName))) {
+    this->throwParserError(preError + " but file '" + fileName + "' " + postError + " was not found");
+  }
+
+  int columnEbyN  = 0;
+  int columnN     = 1;
+  int columnCoeff = 2;
+  int numPointsEN = 200;
+  int numPointsN  = 20;
+
+  LookupTable::Spacing       spacingEN     = LookupTable::Spacing::Exponential;
+  LookupTable::Spacing       spacingN      = LookupTable::Spacing::Uniform;
+  LookupTable::Interpolation interpolation = LookupTable::Interpolation::Linear;
+
+  auto parseSpacing = [this, &preError](const std::string& a_spacing) -> LookupTable::Spacing {
+    LookupTable::Spacing spacing = LookupTable::Spacing::Uniform;
+
+    if (a_spacing == "linear") {
+      spacing = LookupTable::Spacing::Uniform;
+    }
+    else if (a_spacing == "exponential") {
+      spacing = LookupTable::Spacing::Exponential;
+    }
+    else {
+      this->throwParserError(preError + " but spacing '" + a_spacing + "' is not supported");
+    }
+
+    return spacing;
+  };
+
+  if (a_tableEntry.contains("E/N column")) {
+    columnEbyN = a_tableEntry["E/N column"].get<int>();
+  }
+  if (a_tableEntry.contains("N column")) {
+    columnN = a_tableEntry["N column"].get<int>();
+  }
+  if (a_tableEntry.contains(a_dataID + " column")) {
+    columnCoeff = a_tableEntry[a_dataID + " column"].get<int>();
+  }
+  if (a_tableEntry.contains("num points E/N")) {
+    numPointsEN = a_tableEntry["num points E/N"].get<int>();
+  }
+  if (a_tableEntry.contains("num points N")) {
+    numPointsN = a_tableEntry["num points N"].get<int>();
+  }
+  if (a_tableEntry.contains("spacing E/N")) {
+    spacingEN = parseSpacing(this->trim(a_tableEntry["spacing E/N"].get<std::string>()));
+  }
+  if (a_tableEntry.contains("spacing N")) {
+    spacingN = parseSpacing(this->trim(a_tableEntry["spacing N"].get<std::string>()));
+  }
+  if (a_tableEntry.contains("interpolation")) {
+    const std::string whichInterpolation = this->trim(a_tableEntry["interpolation"].get<std::string>());
+
+    if (whichInterpolation == "bilinear") {
+      interpolation = LookupTable::Interpolation::Linear;
+    }
+    else if (whichInterpolation == "bicubic") {
+      interpolation = LookupTable::Interpolation::Cubic;
+    }
+    else {
+      this->throwParserError(preError + " but interpolation '" + whichInterpolation + "' is not supported");
+    }
+  }
+
+  LookupTable2D<Real> tabulatedCoefficient = DataParser::simpleFileReadASCII2D(fileName, columnEbyN, columnN, columnCoeff);
+
+  // Scale table if asked
+  if (a_tableEntry.contains("scale E/N")) {
+    const Real scaling = a_tableEntry["scale E/N"].get<Real>();
+    if (scaling <= 0.0) {
+      this->throwParserWarning(preError + " but shouldn't have 'scale E/N' <= 0.0 for " + postError);
+    }
+
+    tabulatedCoefficient.scale<0>(scaling);
+  }
+  if (a_tableEntry.contains("scale N")) {
+    const Real scaling = a_tableEntry["scale N"].get<Real>();
+    if (scaling <= 0.0) {
+      this->throwParserWarning(preError + " but shouldn't have 'scale N' <= 0.0 for " + postError);
+    }
+
+    tabulatedCoefficient.scale<1>(scaling);
+  }
+  if (a_tableEntry.contains("scale " + a_dataID)) {
+    const Real scaling = a_tableEntry["scale " + a_dataID].get<Real>();
+    if (scaling <= 0.0) {
+      this->throwParserWarning(preError + " but shouldn't have 'scale " + a_dataID + "' <= 0.0 for " + postError);
+    }
+
+    tabulatedCoefficient.scale<2>(scaling);
+  }
+
+  // Set min/max range for internal table
+  Real minEbyN = -std::numeric_limits<Real>::max();
+  Real maxEbyN = +std::numeric_limits<Real>::max();
+  Real minN    = -std::numeric_limits<Real>::max();
+  Real maxN    = +std::numeric_limits<Real>::max();
+  if (a_tableEntry.contains("min E/N")) {
+    minEbyN = a_tableEntry["min E/N"].get<Real>();
+  }
+  if (a_tableEntry.contains("max E/N")) {
+    maxEbyN = a_tableEntry["max E/N"].get<Real>();
+  }
+  if (a_tableEntry.contains("min N")) {
+    minN = a_tableEntry["min N"].get<Real>();
+  }
+  if (a_tableEntry.contains("max N")) {
+    maxN = a_tableEntry["max N"].get<Real>();
+  }
+
+  tabulatedCoefficient.truncate(minEbyN, maxEbyN, 0);
+  tabulatedCoefficient.truncate(minN, maxN, 1);
+  tabulatedCoefficient.setInterpolation(interpolation);
+
+  try {
+    tabulatedCoefficient.prepareTable(numPointsEN, spacingEN, numPointsN, spacingN);
+  }
+  catch (const std::runtime_error& e) {
+    this->throwParserError(preError + " but could not prepare table " + postError + " (" + e.what() + ")");
+  }
+
+  if (a_tableEntry.contains("dump")) {
+    const std::string dumpFile = this->trim(a_tableEntry["dump"].get<std::string>());
+
+    tabulatedCoefficient.writeStructuredData(dumpFile);
+  }
+
+  return tabulatedCoefficient;
+}
+
 std::vector<std::tuple<std::string, std::vector<std::string>, std::vector<std::string>>>
 ItoKMCJSON::parseReactionWildcards(const std::vector<std::string>& a_reactants,
                                    const std::vector<std::string>& a_products,
@@ -378,6 +378,152 @@ AmrMesh::allocate(EBAMRIVData&             a_data,
   a_data.setRealm(a_realm);
 }
 
+void
+AmrMesh::leaseScratch(EBAMRCellLease&          a_lease,
+                      const std::string        a_realm,
+                      const phase::which_phase a_phase,
+                      const int                a_nComp,
+                      const int                a_ghost) const
+{
+  CH_TIME("AmrMesh::leaseScratch(EBAMRCellLease, string, phase::which_phase, int, int)");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::leaseScratch(EBAMRCellLease, string, phase::which_phase, int, int)" << endl;
+  }
+
+  const int ghost = (a_ghost < 0) ? m_numGhostCells : a_ghost;
+
+  auto allocator = [&](EBAMRCellData& a_data) -> void {
+    this->allocate(a_data, a_realm, a_phase, a_nComp, ghost);
+  };
+
+  if (m_useScratchPool) {
+    a_lease = m_scratchCellPool.lease(std::make_tuple(a_realm, a_phase, a_nComp, ghost), allocator);
+  }
+  else {
+    auto data = std::make_shared<EBAMRCellData>();
+
+    allocator(*data);
+
+    a_lease = EBAMRCellLease(data);
+  }
+}
+
+void
+AmrMesh::leaseScratch(EBAMRFluxLease&          a_lease,
+                      const std::string        a_realm,
+                      const phase::which_phase a_phase,
+                      const int                a_nComp,
+                      const int                a_ghost) const
+{
+  CH_TIME("AmrMesh::leaseScratch(EBAMRFluxLease, string, phase::which_phase, int, int)");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::leaseScratch(EBAMRFluxLease, string, phase::which_phase, int, int)" << endl;
+  }
+
+  const int ghost = (a_ghost < 0) ? m_numGhostCells : a_ghost;
+
+  auto allocator = [&](EBAMRFluxData& a_data) -> void {
+    this->allocate(a_data, a_realm, a_phase, a_nComp, ghost);
+  };
+
+  if (m_useScratchPool) {
+    a_lease = m_scratchFluxPool.lease(std::make_tuple(a_realm, a_phase, a_nComp, ghost), allocator);
+  }
+  else {
+    auto data = std::make_shared<EBAMRFluxData>();
+
+    allocator(*data);
+
+    a_lease = EBAMRFluxLease(data);
+  }
+}
+
+void
+AmrMesh::leaseScratch(EBAMRIVLease&            a_lease,
+                      const std::string        a_realm,
+                      const phase::which_phase a_phase,
+                      const int                a_nComp,
+                      const int                a_ghost) const
+{
+  CH_TIME("AmrMesh::leaseScratch(EBAMRIVLease, string, phase::which_phase, int, int)");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::leaseScratch(EBAMRIVLease, string, phase::which_phase, int, int)" << endl;
+  }
+
+  const int ghost = (a_ghost < 0) ? m_numGhostCells : a_ghost;
+
+  auto allocator = [&](EBAMRIVData& a_data) -> void {
+    this->allocate(a_data, a_realm, a_phase, a_nComp, ghost);
+  };
+
+  if (m_useScratchPool) {
+    a_lease = m_scratchIVPool.lease(std::make_tuple(a_realm, a_phase, a_nComp, ghost), allocator);
+  }
+  else {
+    auto data = std::make_shared<EBAMRIVData>();
+
+    allocator(*data);
+
+    a_lease = EBAMRIVLease(data);
+  }
+}
+
+void
+AmrMesh::clearScratchPools() const noexcept
+{
+  CH_TIME("AmrMesh::clearScratchPools()");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::clearScratchPools()" << endl;
+  }
+
+  m_scratchCellPool.clear();
+  m_scratchFluxPool.clear();
+  m_scratchIVPool.clear();
+}
+
+void
+AmrMesh::trimScratchPools() const noexcept
+{
+  CH_TIME("AmrMesh::trimScratchPools()");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::trimScratchPools()" << endl;
+  }
+
+  m_scratchCellPool.trim();
+  m_scratchFluxPool.trim();
+  m_scratchIVPool.trim();
+}
+
+void
+AmrMesh::resetScratchStatistics() const noexcept
+{
+  CH_TIME("AmrMesh::resetScratchStatistics()");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::resetScratchStatistics()" << endl;
+  }
+
+  m_scratchCellPool.resetStatistics();
+  m_scratchFluxPool.resetStatistics();
+  m_scratchIVPool.resetStatistics();
+}
+
+void
+AmrMesh::getScratchStatistics(long& a_numHits, long& a_numMisses, Real& a_savedTime) const noexcept
+{
+  CH_TIME("AmrMesh::getScratchStatistics(long, long, Real)");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::getScratchStatistics(long, long, Real)" << endl;
+  }
+
+  a_numHits   = m_scratchCellPool.getNumHits() + m_scratchFluxPool.getNumHits() + m_scratchIVPool.getNumHits();
+  a_numMisses = m_scratchCellPool.getNumMisses() + m_scratchFluxPool.getNumMisses() + m_scratchIVPool.getNumMisses();
+
+  // Estimate the saved time from the average allocation time in each pool.
+  a_savedTime = m_scratchCellPool.getNumHits() * m_scratchCellPool.getAverageMissTime();
+  a_savedTime += m_scratchFluxPool.getNumHits() * m_scratchFluxPool.getAverageMissTime();
+  a_savedTime += m_scratchIVPool.getNumHits() * m_scratchIVPool.getAverageMissTime();
+}
+
 void
 AmrMesh::allocate(EBAMRIFData&             a_data,
                   const std::string        a_realm,
@@ -940,6 +1086,7 @@ AmrMesh::parseOptions()
   this->parseCentroidStencils();
   this->parseEbCentroidStencils();
   this->parseMultigridInterpolator();
+  this->parseScratchPool();
 
   this->sanityCheck();
   this->buildDomains();
@@ -961,6 +1108,7 @@ AmrMesh::parseRuntimeOptions()
   this->parseBrBufferSize();
   this->parseBrFillRatio();
   this->parseMultigridInterpolator();
+  this->parseScratchPool();
 }
 
 void
@@ -1017,6 +1165,9 @@ AmrMesh::preRegrid()
   m_hasRegridCopiers = false;
   m_oldFinestLevel   = m_finestLevel;
 
+  // Release pooled scratch data -- it is defined over the old grids.
+  this->clearScratchPools();
+
   // Save the old grids and clear the old copiers.
   for (auto& r : m_realms) {
     Vector<DisjointBoxLayout>& oldGrids    = m_oldGrids[r.first];
@@ -1194,6 +1345,14 @@ AmrMesh::buildGrids(const Vector<IntVectSet>& a_tags, const int a_lmin, const in
 
       break;
     }
+    case GridGenerationMethod::TiledDistributed: {
+      TiledMeshRefine meshRefine(m_domains[0], m_refinementRatios, m_blockingFactor * IntVect::Unit, true);
+
+      newFinestLevel = meshRefine.regrid(newBoxes, a_tags);
+      newBoxes[0]    = oldBoxes[0];
+
+      break;
+    }
     default: {
       MayDay::Error("AmrMesh::buildGrids - logic bust, regridding with unknown regrid algorithm");
 
@@ -2531,6 +2690,9 @@ AmrMesh::parseGridGeneration()
   else if (str == "tiled") {
     m_gridGenerationMethod = GridGenerationMethod::Tiled;
   }
+  else if (str == "tiled_distributed") {
+    m_gridGenerationMethod = GridGenerationMethod::TiledDistributed;
+  }
   else {
     MayDay::Abort("AmrMesh::parseGridGeneration - unknown grid generation method requested");
   }
@@ -2627,6 +2789,25 @@ AmrMesh::parseMultigridInterpolator()
     MayDay::Error("AmrMesh::parseMultigridInterpolator -- you have specified negative weighting");
 }
 
+void
+AmrMesh::parseScratchPool()
+{
+  CH_TIME("AmrMesh::parseScratchPool()");
+  if (m_verbosity > 3) {
+    pout() << "AmrMesh::parseScratchPool()" << endl;
+  }
+
+  ParmParse pp("AmrMesh");
+
+  m_useScratchPool = true;
+
+  pp.query("scratch_pool", m_useScratchPool);
+
+  if (!m_useScratchPool) {
+    this->clearScratchPools();
+  }
+}
+
 void
 AmrMesh::parseRedistributionRadius()
 {
@@ -3306,6 +3487,27 @@ AmrMesh::getNonConservativeDivergenceStencils(const std::string a_realm, const p
   return m_realms[a_realm]->getNonConservativeDivergenceStencils(a_phase);
 }
 
+IrregStencilCache::Statistics
+AmrMesh::getStencilCacheStatistics(const std::string a_realm) const
+{
+  CH_TIME("AmrMesh::getStencilCacheStatistics(string)");
+  if (m_verbosity > 1) {
+    pout() << "AmrMesh::getStencilCacheStatistics(string)" << endl;
+  }
+
+  if (!this->queryRealm(a_realm)) {
+    const std::string str = "AmrMesh::getStencilCacheStatistics(string) - could not find realm '" + a_realm + "'";
+    MayDay::Abort(str.c_str());
+  }
+
+  IrregStencilCache::Statistics statistics;
+
+  statistics += m_realms[a_realm]->getStencilCacheStatistics(phase::gas);
+  statistics += m_realms[a_realm]->getStencilCacheStatistics(phase::solid);
+
+  return statistics;
+}
+
 bool
 AmrMesh::queryRealm(const std::string a_realm) const
 {
@@ -3388,6 +3590,9 @@ AmrMesh::defineRealms()
     pout() << "AmrMesh::defineRealms()" << endl;
   }
 
+  // Grids are changing so scratch data can no longer be reused.
+  this->clearScratchPools();
+
   for (auto& r : m_realms) {
     r.second->define(m_grids,
                      m_domains,
@@ -3430,6 +3635,9 @@ AmrMesh::regridRealm(const std::string          a_realm,
     MayDay::Abort(str.c_str());
   }
 
+  // Grids are changing so scratch data can no longer be reused.
+  this->clearScratchPools();
+
   // Make the dbl
   Vector<DisjointBoxLayout> grids(1 + m_finestLevel);
 
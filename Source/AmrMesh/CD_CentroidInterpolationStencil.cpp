@@ -20,19 +20,20 @@
 
 #define DEBUG_CENTROID_INTERP 0
 
-CentroidInterpolationStencil::CentroidInterpolationStencil(const DisjointBoxLayout&        a_dbl,
-                                                           const EBISLayout&               a_ebisl,
-                                                           const ProblemDomain&            a_domain,
-                                                           const Real&                     a_dx,
-                                                           const int                       a_order,
-                                                           const int                       a_radius,
-                                                           const IrregStencil::StencilType a_type)
+CentroidInterpolationStencil::CentroidInterpolationStencil(const DisjointBoxLayout&                a_dbl,
+                                                           const EBISLayout&                       a_ebisl,
+                                                           const ProblemDomain&                    a_domain,
+                                                           const Real&                             a_dx,
+                                                           const int                               a_order,
+                                                           const int                               a_radius,
+                                                           const IrregStencil::StencilType         a_type,
+                                                           const RefCountedPtr<IrregStencilCache>& a_cache)
   : IrregStencil()
 {
 
   CH_TIME("CentroidInterpolationStencil::CentroidInterpolationStencil");
 
-  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, a_type);
+  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, a_type, a_cache);
 }
 
 CentroidInterpolationStencil::~CentroidInterpolationStencil()
@@ -0,0 +1,186 @@
+/* chombo-discharge
+ * Copyright © 2024 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_CompiledStencil.cpp
+  @brief  Implementation of CD_CompiledStencil.H
+  @author Robert Marskar
+*/
+
+// Std includes
+#include <numeric>
+
+// Chombo includes
+#include <CH_Timer.H>
+
+// Our includes
+#include <CD_CompiledStencil.H>
+#include <CD_BoxLoops.H>
+#include <CD_NamespaceHeader.H>
+
+CompiledStencil::CompiledStencil() noexcept
+{
+  m_isDefined      = false;
+  m_numRows        = 0;
+  m_hasMultiValued = false;
+  m_isPartitioned  = false;
+}
+
+CompiledStencil::CompiledStencil(const std::vector<VoFStencil>& a_stencils) noexcept : CompiledStencil()
+{
+  this->define(a_stencils);
+}
+
+CompiledStencil::~CompiledStencil() noexcept
+{}
+
+void
+CompiledStencil::define(const std::vector<VoFStencil>& a_stencils) noexcept
+{
+  CH_TIME("CompiledStencil::define(std::vector<VoFStencil>)");
+
+  m_numRows        = 0;
+  m_hasMultiValued = false;
+  m_isPartitioned  = false;
+  m_boundBox       = Box();
+
+  m_rowPtr.resize(0);
+  m_rowSplit.resize(0);
+  m_weights.resize(0);
+  m_offsets.resize(0);
+  m_vofs.resize(0);
+
+  m_rowPtr.emplace_back(0);
+
+  for (const auto& stencil : a_stencils) {
+    this->addRow(stencil);
+  }
+
+  m_isDefined = true;
+}
+
+void
+CompiledStencil::define(VoFIterator& a_vofit, const BaseIVFAB<VoFStencil>& a_stencils, const int a_stencilComp) noexcept
+{
+  CH_TIME("CompiledStencil::define(VoFIterator, BaseIVFAB<VoFStencil>, int)");
+
+  std::vector<VoFStencil> stencils;
+
+  auto kernel = [&](const VolIndex& vof) -> void {
+    stencils.emplace_back(a_stencils(vof, a_stencilComp));
+  };
+
+  BoxLoops::loop(a_vofit, kernel);
+
+  this->define(stencils);
+}
+
+void
+CompiledStencil::define(FaceIterator& a_faceit, const BaseIFFAB<VoFStencil>& a_stencils, const int a_stencilComp) noexcept
+{
+  CH_TIME("CompiledStencil::define(FaceIterator, BaseIFFAB<VoFStencil>, int)");
+
+  std::vector<VoFStencil> stencils;
+
+  auto kernel = [&](const FaceIndex& face) -> void {
+    stencils.emplace_back(a_stencils(face, a_stencilComp));
+  };
+
+  BoxLoops::loop(a_faceit, kernel);
+
+  this->define(stencils);
+}
+
+void
+CompiledStencil::addRow(const VoFStencil& a_stencil) noexcept
+{
+  for (int i = 0; i < a_stencil.size(); i++) {
+    m_vofs.emplace_back(a_stencil.vof(i));
+    m_weights.emplace_back(a_stencil.weight(i));
+    m_offsets.emplace_back(0L);
+  }
+
+  m_rowPtr.emplace_back(m_weights.size());
+  m_rowSplit.emplace_back(m_weights.size());
+
+  m_numRows++;
+}
+
+void
+CompiledStencil::bind(const EBCellFAB& a_data) const noexcept
+{
+  CH_assert(m_isDefined);
+
+  const Box& dataBox = a_data.box();
+
+  if (m_isPartitioned && dataBox == m_boundBox) {
+    return;
+  }
+
+  CH_TIME("CompiledStencil::bind");
+
+  const EBISBox& ebisBox = a_data.getEBISBox();
+
+  // Move the multi-valued entries to the end of each row. This only needs to be done once because the multi-valuedness of a cell
+  // does not depend on the data layout.
+  if (!m_isPartitioned) {
+    m_hasMultiValued = false;
+
+    for (int row = 0; row < m_numRows; row++) {
+      const int begin = m_rowPtr[row];
+      const int end   = m_rowPtr[row + 1];
+
+      std::vector<VolIndex> vofs;
+      std::vector<Real>     weights;
+
+      for (int pass = 0; pass < 2; pass++) {
+        for (int i = begin; i < end; i++) {
+          const bool isMultiValued = ebisBox.isMultiValued(m_vofs[i].gridIndex());
+
+          if (isMultiValued == (pass == 1)) {
+            vofs.emplace_back(m_vofs[i]);
+            weights.emplace_back(m_weights[i]);
+          }
+        }
+
+        if (pass == 0) {
+          m_rowSplit[row] = begin + vofs.size();
+        }
+      }
+
+      for (int i = begin; i < end; i++) {
+        m_vofs[i]    = vofs[i - begin];
+        m_weights[i] = weights[i - begin];
+      }
+
+      m_hasMultiValued = m_hasMultiValued || (m_rowSplit[row] < end);
+    }
+
+    m_isPartitioned = true;
+  }
+
+  // Compute the offsets. Single-valued cells index directly into the regular data while multi-valued cells index into the
+  // multi-valued data.
+  const BaseFab<Real>& regData = a_data.getSingleValuedFAB();
+  const Box&           regBox  = regData.box();
+
+  for (int row = 0; row < m_numRows; row++) {
+    for (int i = m_rowPtr[row]; i < m_rowSplit[row]; i++) {
+      m_offsets[i] = regBox.index(m_vofs[i].gridIndex());
+    }
+
+    if (m_hasMultiValued) {
+      const Real* multiData = a_data.getMultiValuedFAB().dataPtr(0);
+
+      for (int i = m_rowSplit[row]; i < m_rowPtr[row + 1]; i++) {
+        m_offsets[i] = &a_data(m_vofs[i], 0) - multiData;
+      }
+    }
+  }
+
+  m_boundBox = dataBox;
+}
+
+#include <CD_NamespaceFooter.H>
@@ -134,9 +134,12 @@ EBCoarAve::defineCellStencils() noexcept
   const int  nbox     = ditCoar.size();
 
   m_irregCellsCoFi.define(dblCoar);
+  m_irregVoFsCoFi.define(dblCoar);
   m_cellConservativeStencils.define(dblCoar);
   m_cellArithmeticStencils.define(dblCoar);
   m_cellHarmonicStencils.define(dblCoar);
+  m_cellConservativeCompiled.define(dblCoar);
+  m_cellArithmeticCompiled.define(dblCoar);
 
 #pragma omp parallel for schedule(runtime)
   for (int mybox = 0; mybox < nbox; mybox++) {
@@ -188,6 +191,17 @@ EBCoarAve::defineCellStencils() noexcept
     };
 
     BoxLoops::loop(irregCells, buildStencils);
+
+    // Flattened stencils for the arithmetic and conservative averages.
+    std::vector<VolIndex>& irregVoFs = m_irregVoFsCoFi[din];
+
+    irregVoFs.resize(0);
+    for (irregCells.reset(); irregCells.ok(); ++irregCells) {
+      irregVoFs.emplace_back(irregCells());
+    }
+
+    m_cellArithmeticCompiled[din].define(irregCells, arithmeticStencils);
+    m_cellConservativeCompiled[din].define(irregCells, conservativeStencils);
   }
 }
 
@@ -457,7 +471,8 @@ EBCoarAve::arithmeticAverage(EBCellFAB&       a_coarData,
   FArrayBox&       coarDataReg = a_coarData.getFArrayBox();
   const FArrayBox& fineDataReg = a_fineData.getFArrayBox();
 
-  const BaseIVFAB<VoFStencil>& coarseningStencils = m_cellArithmeticStencils[a_datInd];
+  const CompiledStencil&       coarseningStencils = m_cellArithmeticCompiled[a_datInd];
+  const std::vector<VolIndex>& irregVoFs          = m_irregVoFsCoFi[a_datInd];
 
   // Coarsening of regular cells.
   auto regularKernel = [&](const IntVect& iv) -> void {
@@ -471,14 +486,8 @@ EBCoarAve::arithmeticAverage(EBCellFAB&       a_coarData,
   };
 
   // Coarsening of cut-cells.
-  auto irregularKernel = [&](const VolIndex& vof) -> void {
-    a_coarData(vof, a_coarVar) = 0.0;
-
-    const VoFStencil& stencil = coarseningStencils(vof, 0);
-
-    for (int i = 0; i < stencil.size(); i++) {
-      a_coarData(vof, a_coarVar) += stencil.weight(i) * a_fineData(stencil.vof(i), a_fineVar);
-    }
+  auto irregularKernel = [&](const int row, const Real value) -> void {
+    a_coarData(irregVoFs[row], a_coarVar) = value;
   };
 
   CH_START(t1);
@@ -488,9 +497,7 @@ EBCoarAve::arithmeticAverage(EBCellFAB&       a_coarData,
   CH_STOP(t1);
 
   CH_START(t2);
-  VoFIterator& vofit = m_irregCellsCoFi[a_datInd];
-
-  BoxLoops::loop(vofit, irregularKernel);
+  coarseningStencils.gather(a_fineData, a_fineVar, irregularKernel);
   CH_STOP(t2);
 }
 
@@ -580,7 +587,8 @@ EBCoarAve::conservativeAverage(EBCellFAB&       a_coarData,
   FArrayBox&       coarDataReg = a_coarData.getFArrayBox();
   const FArrayBox& fineDataReg = a_fineData.getFArrayBox();
 
-  const BaseIVFAB<VoFStencil>& coarseningStencils = m_cellConservativeStencils[a_datInd];
+  const CompiledStencil&       coarseningStencils = m_cellConservativeCompiled[a_datInd];
+  const std::vector<VolIndex>& irregVoFs          = m_irregVoFsCoFi[a_datInd];
 
   // Coarsening of regular cells.
   auto regularKernel = [&](const IntVect& iv) -> void {
@@ -594,14 +602,8 @@ EBCoarAve::conservativeAverage(EBCellFAB&       a_coarData,
   };
 
   // Coarsening of cut-cells.
-  auto irregularKernel = [&](const VolIndex& vof) -> void {
-    a_coarData(vof, a_coarVar) = 0.0;
-
-    const VoFStencil& stencil = coarseningStencils(vof, 0);
-
-    for (int i = 0; i < stencil.size(); i++) {
-      a_coarData(vof, a_coarVar) += stencil.weight(i) * a_fineData(stencil.vof(i), a_fineVar);
-    }
+  auto irregularKernel = [&](const int row, const Real value) -> void {
+    a_coarData(irregVoFs[row], a_coarVar) = value;
   };
 
   CH_START(t1);
@@ -611,9 +613,7 @@ EBCoarAve::conservativeAverage(EBCellFAB&       a_coarData,
   CH_STOP(t1);
 
   CH_START(t2);
-  VoFIterator& vofit = m_irregCellsCoFi[a_datInd];
-
-  BoxLoops::loop(vofit, irregularKernel);
+  coarseningStencils.gather(a_fineData, a_fineVar, irregularKernel);
   CH_STOP(t2);
 }
 
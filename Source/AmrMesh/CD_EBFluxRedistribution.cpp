@@ -162,6 +162,10 @@ EBFluxRedistribution::defineStencils() noexcept
   m_redistStencilsCoar.define(dbl);
   m_redistStencilsLevel.define(dbl);
   m_redistStencilsFine.define(dbl);
+  m_redistVoFs.define(dbl);
+  m_compiledStencilsCoar.define(dbl);
+  m_compiledStencilsLevel.define(dbl);
+  m_compiledStencilsFine.define(dbl);
 
 #pragma omp parallel for schedule(runtime)
   for (int mybox = 0; mybox < nbox; mybox++) {
@@ -292,6 +296,18 @@ EBFluxRedistribution::defineStencils() noexcept
         }
       }
     }
+
+    // Flatten the stencils.
+    std::vector<VolIndex>& redistVoFs = m_redistVoFs[din];
+
+    redistVoFs.resize(0);
+    for (vofit.reset(); vofit.ok(); ++vofit) {
+      redistVoFs.emplace_back(vofit());
+    }
+
+    m_compiledStencilsCoar[din].define(vofit, stencilsCoar);
+    m_compiledStencilsLevel[din].define(vofit, stencilsLevel);
+    m_compiledStencilsFine[din].define(vofit, stencilsFine);
   }
 }
 
@@ -502,24 +518,20 @@ EBFluxRedistribution::redistributeCoar(LevelData<EBCellFAB>&             a_phiCo
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = ditCoar[mybox];
 
-      const BaseIVFAB<Real>&       deltaM   = a_deltaM[din];
-      const BaseIVFAB<VoFStencil>& stencils = m_redistStencilsCoar[din];
+      const BaseIVFAB<Real>&       deltaM     = a_deltaM[din];
+      const CompiledStencil&       stencils   = m_compiledStencilsCoar[din];
+      const std::vector<VolIndex>& redistVoFs = m_redistVoFs[din];
 
       EBCellFAB& buffer = coarBuffer[din];
       buffer.setVal(0.0);
 
       // Apply stencil into buffer.
       CH_START(t1);
-      VoFIterator& vofit = m_vofit[din];
-      for (vofit.reset(); vofit.ok(); ++vofit) {
-        const VolIndex&   vof      = vofit();
-        const VoFStencil& stencil  = stencils(vof, 0);
-        const Real&       massDiff = deltaM(vof, ivar);
-
-        for (int i = 0; i < stencil.size(); i++) {
-          buffer(stencil.vof(i), 0) += a_scaleCoar * stencil.weight(i) * massDiff;
-        }
-      }
+      auto massDiff = [&](const int row) -> Real {
+        return a_scaleCoar * deltaM(redistVoFs[row], ivar);
+      };
+
+      stencils.scatter(buffer, 0, massDiff);
       CH_STOP(t1);
     }
 
@@ -561,24 +573,20 @@ EBFluxRedistribution::redistributeLevel(LevelData<EBCellFAB>&             a_phi,
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
-      const BaseIVFAB<Real>&       deltaM   = a_deltaM[din];
-      const BaseIVFAB<VoFStencil>& stencils = m_redistStencilsLevel[din];
+      const BaseIVFAB<Real>&       deltaM     = a_deltaM[din];
+      const CompiledStencil&       stencils   = m_compiledStencilsLevel[din];
+      const std::vector<VolIndex>& redistVoFs = m_redistVoFs[din];
 
       EBCellFAB& buffer = levelBuffer[din];
       buffer.setVal(0.0);
 
       // Apply stencil into buffer.
       CH_START(t1);
-      VoFIterator& vofit = m_vofit[din];
-      for (vofit.reset(); vofit.ok(); ++vofit) {
-        const VolIndex&   vof      = vofit();
-        const VoFStencil& stencil  = stencils(vof, 0);
-        const Real&       massDiff = deltaM(vof, ivar);
-
-        for (int i = 0; i < stencil.size(); i++) {
-          buffer(stencil.vof(i), 0) += a_scale * stencil.weight(i) * massDiff;
-        }
-      }
+      auto massDiff = [&](const int row) -> Real {
+        return a_scale * deltaM(redistVoFs[row], ivar);
+      };
+
+      stencils.scatter(buffer, 0, massDiff);
       CH_STOP(t1);
     }
 
@@ -620,24 +628,20 @@ EBFluxRedistribution::redistributeFine(LevelData<EBCellFAB>&             a_phiFi
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = ditFine[mybox];
 
-      const BaseIVFAB<Real>&       deltaM   = a_deltaM[din];
-      const BaseIVFAB<VoFStencil>& stencils = m_redistStencilsFine[din];
+      const BaseIVFAB<Real>&       deltaM     = a_deltaM[din];
+      const CompiledStencil&       stencils   = m_compiledStencilsFine[din];
+      const std::vector<VolIndex>& redistVoFs = m_redistVoFs[din];
 
       EBCellFAB& buffer = fineBuffer[din];
       buffer.setVal(0.0);
 
       // Apply stencil into buffer.
       CH_START(t1);
-      VoFIterator& vofit = m_vofit[din];
-      for (vofit.reset(); vofit.ok(); ++vofit) {
-        const VolIndex&   vof      = vofit();
-        const VoFStencil& stencil  = stencils(vof, 0);
-        const Real&       massDiff = deltaM(vof, ivar);
-
-        for (int i = 0; i < stencil.size(); i++) {
-          buffer(stencil.vof(i), 0) += a_scaleFine * stencil.weight(i) * massDiff;
-        }
-      }
+      auto massDiff = [&](const int row) -> Real {
+        return a_scaleFine * deltaM(redistVoFs[row], ivar);
+      };
+
+      stencils.scatter(buffer, 0, massDiff);
       CH_STOP(t1);
     }
 
@@ -145,8 +145,6 @@ EBMGRestrict::restrictResidual(LevelData<EBCellFAB>&       a_coarData,
       FArrayBox&       coarDataReg = coarData.getFArrayBox();
       const FArrayBox& fineDataReg = fineData.getFArrayBox();
 
-      const BaseIVFAB<VoFStencil>& restrictStencils = m_restrictStencils[din];
-
       // Regular kernel.
       auto regularKernel = [&](const IntVect& ivCoar) -> void {
         for (BoxIterator bit(refineBox); bit.ok(); ++bit) {
@@ -156,31 +154,17 @@ EBMGRestrict::restrictResidual(LevelData<EBCellFAB>&       a_coarData,
         }
       };
 
-      // Irregular kernel
-      auto irregularKernel = [&](const VolIndex& coarVoF) -> void {
-        const VoFStencil& restrictSten = restrictStencils(coarVoF, 0);
-
-        coarData(coarVoF, 0) = 0.0;
-        for (int i = 0; i < restrictSten.size(); i++) {
-          const VolIndex& fineVoF    = restrictSten.vof(i);
-          const Real&     fineWeight = restrictSten.weight(i);
-
-          coarData(coarVoF, 0) += fineWeight * fineData(fineVoF, ivar);
-        }
-      };
-
       // Run kernels
       coarData.setVal(0.0);
 
-      const Box    coarBox  = dblCoFi[din];
-      VoFIterator& coarVoFs = m_vofitCoar[din];
+      const Box coarBox = dblCoFi[din];
 
       CH_START(t2);
       BoxLoops::loop(coarBox, regularKernel);
       CH_STOP(t2);
 
       CH_START(t3);
-      BoxLoops::loop(coarVoFs, irregularKernel);
+      this->restrictIrregular(coarData, fineData, din, 0, ivar);
       CH_STOP(t3);
     }
 
@@ -191,4 +175,79 @@ EBMGRestrict::restrictResidual(LevelData<EBCellFAB>&       a_coarData,
   }
 }
 
+void
+EBMGRestrict::restrictResidual(LevelData<EBCellFAB>& a_coarData,
+                               LevelData<EBCellFAB>& a_fineData,
+                               const int             a_variable,
+                               const FineKernel&     a_fineKernel) const noexcept
+{
+  CH_TIMERS("EBMGRestrict::restrictResidual(fused)");
+  CH_TIMER("EBMGRestrict::restrictResidual(fused)::fine_kernel", t1);
+  CH_TIMER("EBMGRestrict::restrictResidual(fused)::irregular_cells", t2);
+
+  CH_assert(m_isDefined);
+  CH_assert(a_coarData.nComp() > a_variable);
+  CH_assert(a_fineData.nComp() > a_variable);
+
+  const DisjointBoxLayout& dblCoFi   = m_eblgCoFi.getDBL();
+  const EBISLayout&        ebislCoFi = m_eblgCoFi.getEBISL();
+
+  LevelData<EBCellFAB> coFiData(dblCoFi, 1, IntVect::Zero, EBCellFactory(ebislCoFi));
+
+  const DataIterator& dit  = dblCoFi.dataIterator();
+  const int           nbox = dit.size();
+
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din      = dit[mybox];
+    EBCellFAB&       coarData = coFiData[din];
+
+    coarData.setVal(0.0);
+
+    // Compute the fine-grid data and restrict it in the regular cells.
+    CH_START(t1);
+    a_fineKernel(coarData, din);
+    CH_STOP(t1);
+
+    // Restrict onto the coarse cut-cells.
+    CH_START(t2);
+    this->restrictIrregular(coarData, a_fineData[din], din, 0, a_variable);
+    CH_STOP(t2);
+  }
+
+  coFiData.copyTo(Interval(0, 0), a_coarData, Interval(a_variable, a_variable), m_copier);
+}
+
+int
+EBMGRestrict::getRefRat() const noexcept
+{
+  return m_refRat;
+}
+
+void
+EBMGRestrict::restrictIrregular(EBCellFAB&       a_coarData,
+                                const EBCellFAB& a_fineData,
+                                const DataIndex& a_din,
+                                const int        a_coarVar,
+                                const int        a_fineVar) const noexcept
+{
+  CH_TIME("EBMGRestrict::restrictIrregular");
+
+  const BaseIVFAB<VoFStencil>& restrictStencils = m_restrictStencils[a_din];
+
+  auto irregularKernel = [&](const VolIndex& coarVoF) -> void {
+    const VoFStencil& restrictSten = restrictStencils(coarVoF, 0);
+
+    a_coarData(coarVoF, a_coarVar) = 0.0;
+    for (int i = 0; i < restrictSten.size(); i++) {
+      const VolIndex& fineVoF    = restrictSten.vof(i);
+      const Real&     fineWeight = restrictSten.weight(i);
+
+      a_coarData(coarVoF, a_coarVar) += fineWeight * a_fineData(fineVoF, a_fineVar);
+    }
+  };
+
+  BoxLoops::loop(m_vofitCoar[a_din], irregularKernel);
+}
+
 #include <CD_NamespaceFooter.H>
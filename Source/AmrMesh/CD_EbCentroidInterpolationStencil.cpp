@@ -18,18 +18,19 @@
 #include <CD_LeastSquares.H>
 #include <CD_NamespaceHeader.H>
 
-EbCentroidInterpolationStencil::EbCentroidInterpolationStencil(const DisjointBoxLayout&        a_dbl,
-                                                               const EBISLayout&               a_ebisl,
-                                                               const ProblemDomain&            a_domain,
-                                                               const Real&                     a_dx,
-                                                               const int                       a_order,
-                                                               const int                       a_radius,
-                                                               const IrregStencil::StencilType a_type)
+EbCentroidInterpolationStencil::EbCentroidInterpolationStencil(const DisjointBoxLayout&                a_dbl,
+                                                               const EBISLayout&                       a_ebisl,
+                                                               const ProblemDomain&                    a_domain,
+                                                               const Real&                             a_dx,
+                                                               const int                               a_order,
+                                                               const int                               a_radius,
+                                                               const IrregStencil::StencilType         a_type,
+                                                               const RefCountedPtr<IrregStencilCache>& a_cache)
   : IrregStencil()
 {
   CH_TIME("EbCentroidInterpolationStencil::EbCentroidInterpolationStencil");
 
-  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, a_type);
+  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, a_type, a_cache);
 }
 
 EbCentroidInterpolationStencil::~EbCentroidInterpolationStencil()
@@ -9,6 +9,13 @@
   @author Robert Marskar
 */
 
+// Std includes
+#include <sstream>
+#include <iomanip>
+#include <typeinfo>
+#include <chrono>
+#include <algorithm>
+
 // Chombo includes
 #include <NeighborIterator.H>
 
@@ -26,16 +33,17 @@ IrregStencil::IrregStencil()
 IrregStencil::~IrregStencil()
 {}
 
-IrregStencil::IrregStencil(const DisjointBoxLayout&        a_dbl,
-                           const EBISLayout&               a_ebisl,
-                           const ProblemDomain&            a_domain,
-                           const Real&                     a_dx,
-                           const int                       a_order,
-                           const int                       a_radius,
-                           const IrregStencil::StencilType a_type)
+IrregStencil::IrregStencil(const DisjointBoxLayout&                a_dbl,
+                           const EBISLayout&                       a_ebisl,
+                           const ProblemDomain&                    a_domain,
+                           const Real&                             a_dx,
+                           const int                               a_order,
+                           const int                               a_radius,
+                           const IrregStencil::StencilType         a_type,
+                           const RefCountedPtr<IrregStencilCache>& a_cache)
 {
 
-  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, a_type);
+  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, a_type, a_cache);
 }
 
 const BaseIVFAB<VoFStencil>&
@@ -51,13 +59,14 @@ IrregStencil::operator[](const DataIndex& a_dit)
 }
 
 void
-IrregStencil::define(const DisjointBoxLayout&        a_dbl,
-                     const EBISLayout&               a_ebisl,
-                     const ProblemDomain&            a_domain,
-                     const Real&                     a_dx,
-                     const int                       a_order,
-                     const int                       a_radius,
-                     const IrregStencil::StencilType a_type)
+IrregStencil::define(const DisjointBoxLayout&                a_dbl,
+                     const EBISLayout&                       a_ebisl,
+                     const ProblemDomain&                    a_domain,
+                     const Real&                             a_dx,
+                     const int                               a_order,
+                     const int                               a_radius,
+                     const IrregStencil::StencilType         a_type,
+                     const RefCountedPtr<IrregStencilCache>& a_cache)
 {
   CH_TIME("IrregStencil::define");
 
@@ -67,8 +76,11 @@ IrregStencil::define(const DisjointBoxLayout&        a_dbl,
   m_radius      = a_radius;
   m_order       = a_order;
   m_stencilType = a_type;
+  m_cache       = a_cache;
 
   m_stencils.define(m_dbl);
+  m_compiledStencils.define(m_dbl);
+  m_vofs.define(m_dbl);
   m_vofIter.define(m_dbl);
 
   const DataIterator& dit  = m_dbl.dataIterator();
@@ -83,6 +95,27 @@ IrregStencil::define(const DisjointBoxLayout&        a_dbl,
     const EBGraph&    ebgraph = ebisbox.getEBGraph();
     const IntVectSet& ivs     = ebisbox.getIrregIVS(box);
 
+    VoFIterator& vofit = m_vofIter[din];
+    vofit.define(ivs, ebgraph);
+
+    // Reuse the stencils if this patch (with the same neighborhood) was already computed.
+    std::string              cacheKey;
+    IrregStencilCache::Entry cacheEntry;
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    if (!m_cache.isNull()) {
+      cacheKey = this->getCacheKey(a_domain, din);
+
+      if (m_cache->find(cacheEntry, cacheKey)) {
+        m_stencils[din]         = cacheEntry.m_stencils;
+        m_compiledStencils[din] = cacheEntry.m_compiledStencils;
+        m_vofs[din]             = cacheEntry.m_vofs;
+
+        continue;
+      }
+    }
+
     // Build the coarse-fine interface around this box
     IntVectSet       cfivs = IntVectSet(grow(box, 1) & m_domain);
     NeighborIterator nit(m_dbl);
@@ -92,9 +125,6 @@ IrregStencil::define(const DisjointBoxLayout&        a_dbl,
 
     m_stencils[din] = RefCountedPtr<BaseIVFAB<VoFStencil>>(new BaseIVFAB<VoFStencil>(ivs, ebgraph, m_defaultNumSten));
 
-    VoFIterator& vofit = m_vofIter[din];
-    vofit.define(ivs, ebgraph);
-
     auto kernel = [&](const VolIndex& vof) -> void {
       VoFStencil& stencil = (*m_stencils[din])(vof, 0);
       this->buildStencil(stencil, vof, m_dbl, m_domain, ebisbox, box, m_dx, cfivs);
@@ -113,63 +143,101 @@ IrregStencil::define(const DisjointBoxLayout&        a_dbl,
     };
 
     BoxLoops::loop(vofit, kernel);
+
+    // Compile the stencils into a flattened representation.
+    std::vector<VolIndex>& vofs = m_vofs[din];
+
+    vofs.resize(0);
+    for (vofit.reset(); vofit.ok(); ++vofit) {
+      vofs.emplace_back(vofit());
+    }
+
+    m_compiledStencils[din].define(vofit, *m_stencils[din], m_defaultStenComp);
+
+    if (!m_cache.isNull()) {
+      const std::chrono::duration<Real> buildTime = std::chrono::steady_clock::now() - startTime;
+
+      cacheEntry.m_stencils         = m_stencils[din];
+      cacheEntry.m_compiledStencils = m_compiledStencils[din];
+      cacheEntry.m_vofs             = m_vofs[din];
+      cacheEntry.m_buildTime        = buildTime.count();
+
+      m_cache->insert(cacheKey, cacheEntry);
+    }
   }
 }
 
-void
-IrregStencil::apply(EBCellFAB& a_dst, const EBCellFAB& a_src, const DataIndex& a_dit) const
+std::string
+IrregStencil::getCacheKey(const ProblemDomain& a_domain, const DataIndex& a_dit) const
 {
-  CH_TIME("IrregStencil::apply");
+  CH_TIME("IrregStencil::getCacheKey");
 
-  const BaseIVFAB<VoFStencil>& stencils = *m_stencils[a_dit];
+  // TLDR: The stencils in a patch depend on the stencil class and its settings, the resolution and domain, the patch itself and the
+  //       region where we have EB information, and the coarse-fine interface around the patch. The latter is computed from the
+  //       neighboring boxes in IrregStencil::define, so we include the parts of the neighboring boxes that overlap with the patch
+  //       grown by one cell. The EB geometry itself does not change between regrids so it does not need to be part of the key.
+  const Box&     box      = m_dbl[a_dit];
+  const EBISBox& ebisbox  = m_ebisl[a_dit];
+  const Box      grownBox = grow(box, 1);
 
-  VoFIterator& vofit = m_vofIter[a_dit];
+  std::vector<Box> neighbors;
 
-  auto kernel = [&](const VolIndex& vof) -> void {
-    const VoFStencil& stencil = stencils(vof, m_defaultStenComp);
+  NeighborIterator nit(m_dbl);
+  for (nit.begin(a_dit); nit.ok(); ++nit) {
+    const Box overlap = m_dbl[nit()] & grownBox;
 
-    for (int comp = 0; comp < a_dst.nComp(); comp++) {
+    if (!overlap.isEmpty()) {
+      neighbors.emplace_back(overlap);
+    }
+  }
 
-      a_dst(vof, comp) = 0.0;
+  std::sort(neighbors.begin(), neighbors.end());
 
-      for (int i = 0; i < stencil.size(); i++) {
-        const VolIndex& ivof    = stencil.vof(i);
-        const Real&     iweight = stencil.weight(i);
+  std::stringstream key;
 
-        a_dst(vof, comp) += iweight * a_src(ivof, comp);
-      }
-    }
-  };
+  key << typeid(*this).name() << "|" << m_order << "|" << m_radius << "|" << static_cast<int>(m_stencilType) << "|"
+      << std::setprecision(17) << m_dx << "|" << a_domain.domainBox() << "|" << a_domain.isPeriodic() << "|" << box << "|"
+      << ebisbox.getRegion();
 
-  BoxLoops::loop(vofit, kernel);
+  for (const auto& neighbor : neighbors) {
+    key << "|" << neighbor;
+  }
+
+  return key.str();
 }
 
 void
-IrregStencil::apply(BaseIVFAB<Real>& a_dst, const EBCellFAB& a_src, const DataIndex& a_dit) const
+IrregStencil::apply(EBCellFAB& a_dst, const EBCellFAB& a_src, const DataIndex& a_dit) const
 {
   CH_TIME("IrregStencil::apply");
 
-  const BaseIVFAB<VoFStencil>& stencils = *m_stencils[a_dit];
-
-  VoFIterator& vofit = m_vofIter[a_dit];
+  const CompiledStencil&       stencils = m_compiledStencils[a_dit];
+  const std::vector<VolIndex>& vofs     = m_vofs[a_dit];
 
-  auto kernel = [&](const VolIndex& vof) -> void {
-    const VoFStencil& stencil = stencils(vof, m_defaultStenComp);
+  for (int comp = 0; comp < a_dst.nComp(); comp++) {
+    auto kernel = [&](const int row, const Real value) -> void {
+      a_dst(vofs[row], comp) = value;
+    };
 
-    for (int comp = 0; comp < a_dst.nComp(); comp++) {
+    stencils.gather(a_src, comp, kernel);
+  }
+}
 
-      a_dst(vof, comp) = 0.0;
+void
+IrregStencil::apply(BaseIVFAB<Real>& a_dst, const EBCellFAB& a_src, const DataIndex& a_dit) const
+{
+  CH_TIME("IrregStencil::apply");
 
-      for (int i = 0; i < stencil.size(); i++) {
-        const VolIndex& ivof    = stencil.vof(i);
-        const Real&     iweight = stencil.weight(i);
+  const CompiledStencil&       stencils = m_compiledStencils[a_dit];
+  const std::vector<VolIndex>& vofs     = m_vofs[a_dit];
 
-        a_dst(vof, comp) += iweight * a_src(ivof, comp);
-      }
-    }
-  };
+  for (int comp = 0; comp < a_dst.nComp(); comp++) {
+    auto kernel = [&](const int row, const Real value) -> void {
+      a_dst(vofs[row], comp) = value;
+    };
 
-  BoxLoops::loop(vofit, kernel);
+    stencils.gather(a_src, comp, kernel);
+  }
 }
 
 #include <CD_NamespaceFooter.H>
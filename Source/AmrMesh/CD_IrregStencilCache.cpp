@@ -0,0 +1,108 @@
+/* chombo-discharge
+ * Copyright © 2024 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_IrregStencilCache.cpp
+  @brief  Implementation of CD_IrregStencilCache.H
+  @author Robert Marskar
+*/
+
+// Our includes
+#include <CD_IrregStencilCache.H>
+#include <CD_NamespaceHeader.H>
+
+IrregStencilCache::IrregStencilCache() noexcept
+{
+  m_generation = 0;
+}
+
+IrregStencilCache::~IrregStencilCache() noexcept
+{}
+
+bool
+IrregStencilCache::find(Entry& a_entry, const std::string& a_key) noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto it = m_entries.find(a_key);
+
+  if (it != m_entries.end()) {
+    it->second.m_generation = m_generation;
+
+    a_entry = it->second;
+
+    m_statistics.m_hits++;
+    m_statistics.m_savedTime += a_entry.m_buildTime;
+
+    return true;
+  }
+
+  m_statistics.m_misses++;
+
+  return false;
+}
+
+void
+IrregStencilCache::insert(const std::string& a_key, const Entry& a_entry) noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  Entry& entry = m_entries[a_key];
+
+  entry              = a_entry;
+  entry.m_generation = m_generation;
+
+  m_statistics.m_buildTime += a_entry.m_buildTime;
+}
+
+void
+IrregStencilCache::newGeneration() noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  m_generation++;
+  m_statistics = Statistics();
+}
+
+void
+IrregStencilCache::prune() noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  for (auto it = m_entries.begin(); it != m_entries.end();) {
+    if (it->second.m_generation != m_generation) {
+      it = m_entries.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+}
+
+void
+IrregStencilCache::clear() noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  m_entries.clear();
+}
+
+size_t
+IrregStencilCache::size() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  return m_entries.size();
+}
+
+IrregStencilCache::Statistics
+IrregStencilCache::getStatistics() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  return m_statistics;
+}
+
+#include <CD_NamespaceFooter.H>
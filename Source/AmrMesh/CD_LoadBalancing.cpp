@@ -9,6 +9,9 @@
   @author  Robert Marskar
 */
 
+// Std includes
+#include <algorithm>
+
 // Chombo includes
 #include <ParmParse.H>
 
@@ -27,6 +30,43 @@ LoadBalancing::sort(Vector<Box>& a_boxes, const BoxSorting a_which)
   LoadBalancing::sort(a_boxes, dummy, a_which);
 }
 
+void
+LoadBalancing::agglomerate(Vector<int>& a_ranks, const Vector<Box>& a_boxes, const long long a_minCellsPerRank) noexcept
+{
+  CH_TIME("LoadBalancing::agglomerate");
+
+  CH_assert(a_minCellsPerRank > 0LL);
+
+  const int numBoxes = a_boxes.size();
+
+  long long numCells = 0LL;
+  for (int ibox = 0; ibox < numBoxes; ibox++) {
+    numCells += a_boxes[ibox].numPts();
+  }
+
+  // Number of ranks that will get boxes. Never more than the number of boxes.
+  long long numRanks = numCells / a_minCellsPerRank;
+
+  numRanks = std::min(numRanks, (long long)numProc());
+  numRanks = std::min(numRanks, (long long)numBoxes);
+  numRanks = std::max(numRanks, 1LL);
+
+  // Walk along the boxes and put each box on the rank that owns the midpoint of the box in the accumulated cell count. Since
+  // the boxes are sorted along a space-filling curve this gives spatially compact, contiguous chunks on each rank.
+  a_ranks.resize(numBoxes);
+
+  long long accumulatedCells = 0LL;
+  for (int ibox = 0; ibox < numBoxes; ibox++) {
+    const long long boxCells = a_boxes[ibox].numPts();
+    const long long midpoint = accumulatedCells + boxCells / 2;
+
+    a_ranks[ibox] = (numCells > 0LL) ? static_cast<int>((midpoint * numRanks) / numCells) : 0;
+    a_ranks[ibox] = std::min(a_ranks[ibox], static_cast<int>(numRanks - 1));
+
+    accumulatedCells += boxCells;
+  }
+}
+
 void
 LoadBalancing::gatherBoxes(Vector<Box>& a_boxes)
 {
@@ -17,20 +17,21 @@
 #include <CD_VofUtils.H>
 #include <CD_NamespaceHeader.H>
 
-NonConservativeDivergenceStencil::NonConservativeDivergenceStencil(const DisjointBoxLayout&        a_dbl,
-                                                                   const EBISLayout&               a_ebisl,
-                                                                   const ProblemDomain&            a_domain,
-                                                                   const Real&                     a_dx,
-                                                                   const int                       a_order,
-                                                                   const int                       a_radius,
-                                                                   const IrregStencil::StencilType a_type)
+NonConservativeDivergenceStencil::NonConservativeDivergenceStencil(const DisjointBoxLayout&                a_dbl,
+                                                                   const EBISLayout&                       a_ebisl,
+                                                                   const ProblemDomain&                    a_domain,
+                                                                   const Real&                             a_dx,
+                                                                   const int                               a_order,
+                                                                   const int                               a_radius,
+                                                                   const IrregStencil::StencilType         a_type,
+                                                                   const RefCountedPtr<IrregStencilCache>& a_cache)
   : IrregStencil()
 {
 
   CH_TIME("NonConservativeDivergenceStencil::NonConservativeDivergenceStencil");
 
   // Order and radius are dummy arguments.
-  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, IrregStencil::StencilType::Linear);
+  this->define(a_dbl, a_ebisl, a_domain, a_dx, a_order, a_radius, IrregStencil::StencilType::Linear, a_cache);
 }
 
 NonConservativeDivergenceStencil::~NonConservativeDivergenceStencil()
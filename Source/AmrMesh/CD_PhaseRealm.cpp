@@ -41,6 +41,14 @@ PhaseRealm::PhaseRealm()
   ParmParse pp("PhaseRealm");
   pp.query("profile", m_profile);
   pp.query("verbosity", m_verbose);
+
+  // Stencils on patches that survive regrids are reused unless the user turns this off.
+  bool useStencilCache = true;
+  pp.query("stencil_cache", useStencilCache);
+
+  if (useStencilCache) {
+    m_stencilCache = RefCountedPtr<IrregStencilCache>(new IrregStencilCache());
+  }
 }
 
 PhaseRealm::~PhaseRealm()
@@ -192,6 +200,10 @@ PhaseRealm::regridOperators(const int a_lmin)
 
     Timer timer("PhaseRealm::regridOperators(int)");
 
+    if (!m_stencilCache.isNull()) {
+      m_stencilCache->newGeneration();
+    }
+
     if (m_profile) {
       pout() << "before/after coarave define" << endl;
       MemoryReport::getMaxMinMemoryUsage();
@@ -324,6 +336,11 @@ PhaseRealm::regridOperators(const int a_lmin)
       pout() << endl;
     }
 
+    // Release the cached stencils on patches that did not survive the regrid.
+    if (!m_stencilCache.isNull()) {
+      m_stencilCache->prune();
+    }
+
     if (m_profile) {
       timer.eventReport(pout());
     }
@@ -819,7 +836,8 @@ PhaseRealm::defineIrregSten()
                                                         m_finestLevel,
                                                         order,
                                                         rad,
-                                                        m_centroidStencilType));
+                                                        m_centroidStencilType,
+                                                        m_stencilCache));
 
     m_ebCentroidInterpolationStencil = RefCountedPtr<IrregAmrStencil<EbCentroidInterpolationStencil>>(
       new IrregAmrStencil<EbCentroidInterpolationStencil>(m_grids,
@@ -829,7 +847,8 @@ PhaseRealm::defineIrregSten()
                                                           m_finestLevel,
                                                           order,
                                                           rad,
-                                                          m_ebCentroidStencilType));
+                                                          m_ebCentroidStencilType,
+                                                          m_stencilCache));
   }
 }
 
@@ -855,7 +874,8 @@ PhaseRealm::defineNonConsDivSten()
         m_finestLevel,
         order, // Dummy argument
         m_redistributionRadius,
-        m_centroidStencilType)); // Dummy argument, just use centroidStencilType.
+        m_centroidStencilType, // Dummy argument, just use centroidStencilType.
+        m_stencilCache));
   }
 }
 
@@ -1025,6 +1045,18 @@ PhaseRealm::getSurfaceDeposition() const
   return m_surfaceDeposition;
 }
 
+IrregStencilCache::Statistics
+PhaseRealm::getStencilCacheStatistics() const
+{
+  IrregStencilCache::Statistics statistics;
+
+  if (!m_stencilCache.isNull()) {
+    statistics = m_stencilCache->getStatistics();
+  }
+
+  return statistics;
+}
+
 const EBAMRFAB&
 PhaseRealm::getLevelset() const
 {
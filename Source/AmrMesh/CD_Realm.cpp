@@ -705,6 +705,12 @@ Realm::getLevelset(const phase::which_phase a_phase) const
   return m_realms[a_phase]->getLevelset();
 }
 
+IrregStencilCache::Statistics
+Realm::getStencilCacheStatistics(const phase::which_phase a_phase) const
+{
+  return m_realms[a_phase]->getStencilCacheStatistics();
+}
+
 const AMRMask&
 Realm::getMask(const std::string a_mask, const int a_buffer) const
 {
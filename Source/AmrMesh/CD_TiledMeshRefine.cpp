@@ -11,6 +11,9 @@
 
 // Std includes
 #include <set>
+#include <map>
+#include <vector>
+#include <cstdint>
 
 // Chombo includes
 #include <BoxIterator.H>
@@ -24,12 +27,14 @@
 
 TiledMeshRefine::TiledMeshRefine(const ProblemDomain& a_coarsestDomain,
                                  const Vector<int>&   a_refRatios,
-                                 const IntVect&       a_tileSize) noexcept
+                                 const IntVect&       a_tileSize,
+                                 const bool           a_distributed) noexcept
 {
   CH_TIME("TiledMeshRefine::TiledMeshRefine");
 
-  m_refRatios = a_refRatios;
-  m_tileSize  = a_tileSize;
+  m_refRatios   = a_refRatios;
+  m_tileSize    = a_tileSize;
+  m_distributed = a_distributed;
 
   m_amrDomains.resize(0);
 
@@ -85,10 +90,18 @@ TiledMeshRefine::regrid(Vector<Vector<Box>>& a_newGrids, const Vector<IntVectSet
     // Coarsest grid just consists of proper nesting around the finer grids. Last argument is dummy.
     this->makeLevelTiles(amrTiles[0], amrTiles[1], IntVectSet(), m_amrDomains[0], m_refRatios[0], 1);
 
-    // Make tiles into boxes
+    // Make tiles into boxes. In distributed mode the tiles are first gathered onto all ranks (DisjointBoxLayout needs all the boxes).
     a_newGrids.resize(1 + newFinestLevel);
     for (int lvl = 0; lvl <= newFinestLevel; lvl++) {
-      this->makeBoxesFromTiles(a_newGrids[lvl], amrTiles[lvl], m_amrDomains[lvl]);
+      if (m_distributed) {
+        std::vector<Tile> allTiles;
+
+        this->gatherTiles(allTiles, amrTiles[lvl]);
+        this->makeBoxesFromTiles(a_newGrids[lvl], allTiles, m_amrDomains[lvl]);
+      }
+      else {
+        this->makeBoxesFromTiles(a_newGrids[lvl], amrTiles[lvl], m_amrDomains[lvl]);
+      }
     }
   }
   else {
@@ -110,6 +123,7 @@ TiledMeshRefine::makeLevelTiles(TileSet&             a_tiles,
   CH_TIMER("TiledMeshRefine::makeLevelTiles::tag_tiles", t1);
   CH_TIMER("TiledMeshRefine::makeLevelTiles::gather_tiles", t2);
   CH_TIMER("TiledMeshRefine::makeLevelTiles::add_fine_tiles", t3);
+  CH_TIMER("TiledMeshRefine::makeLevelTiles::distribute_tiles", t4);
 
   // Generate tiles from tags on the coarser level.
   CH_START(t1);
@@ -135,52 +149,55 @@ TiledMeshRefine::makeLevelTiles(TileSet&             a_tiles,
   }
   CH_STOP(t1);
 
-  // Gather tiles globally
+  // Gather tiles globally. Not done in distributed mode where we only have the tiles owned by this rank.
 #ifdef CH_MPI
-  CH_START(t2);
-  const int mySendCount  = a_tiles.size() * SpaceDim;
-  int*      mySendBuffer = new int[mySendCount];
+  if (!m_distributed) {
+    CH_START(t2);
+    const int mySendCount  = a_tiles.size() * SpaceDim;
+    int*      mySendBuffer = new int[mySendCount];
+
+    // Get the number of elements sent by each MPI rank and compute the offset array which is required by Allgatherv
+    int  recvCount  = mySendCount;
+    int* sendCounts = new int[numProc()];
+    int* offsets    = new int[numProc()];
+
+    MPI_Allreduce(MPI_IN_PLACE, &recvCount, 1, MPI_INT, MPI_SUM, Chombo_MPI::comm);
+    MPI_Allgather(&mySendCount, 1, MPI_INT, sendCounts, 1, MPI_INT, Chombo_MPI::comm);
+    offsets[0] = 0;
+    for (int i = 0; i < numProc() - 1; i++) {
+      offsets[i + 1] = offsets[i] + sendCounts[i];
+    }
 
-  // Get the number of elements sent by each MPI rank and compute the offset array which is required by Allgatherv
-  int  recvCount  = mySendCount;
-  int* sendCounts = new int[numProc()];
-  int* offsets    = new int[numProc()];
+    // Linearize the tiles as integers onto the send buffer
+    int idx = 0;
+    for (const auto& t : a_tiles) {
+      for (int dir = 0; dir < SpaceDim; dir++, idx++) {
+        mySendBuffer[idx] = t[dir];
+      }
+    }
+    a_tiles.clear();
 
-  MPI_Allreduce(MPI_IN_PLACE, &recvCount, 1, MPI_INT, MPI_SUM, Chombo_MPI::comm);
-  MPI_Allgather(&mySendCount, 1, MPI_INT, sendCounts, 1, MPI_INT, Chombo_MPI::comm);
-  offsets[0] = 0;
-  for (int i = 0; i < numProc() - 1; i++) {
-    offsets[i + 1] = offsets[i] + sendCounts[i];
-  }
+    // Allocate storage and gather tiles
+    int* recvBuffer = new int[recvCount];
+    MPI_Allgatherv(mySendBuffer, mySendCount, MPI_INT, recvBuffer, sendCounts, offsets, MPI_INT, Chombo_MPI::comm);
 
-  // Linearize the tiles as integers onto the send buffer
-  int idx = 0;
-  for (const auto& t : a_tiles) {
-    for (int dir = 0; dir < SpaceDim; dir++, idx++) {
-      mySendBuffer[idx] = t[dir];
+    // de-linearize the received data back into tiles
+    for (int i = 0; i < recvCount; i += SpaceDim) {
+      a_tiles.emplace(Tile(D_DECL(recvBuffer[i], recvBuffer[i + 1], recvBuffer[i + 2])));
     }
-  }
-  a_tiles.clear();
 
-  // Allocate storage and gather tiles
-  int* recvBuffer = new int[recvCount];
-  MPI_Allgatherv(mySendBuffer, mySendCount, MPI_INT, recvBuffer, sendCounts, offsets, MPI_INT, Chombo_MPI::comm);
+    delete[] recvBuffer;
+    delete[] offsets;
+    delete[] sendCounts;
+    delete[] mySendBuffer;
 
-  // de-linearize the received data back into tiles
-  for (int i = 0; i < recvCount; i += SpaceDim) {
-    a_tiles.emplace(Tile(D_DECL(recvBuffer[i], recvBuffer[i + 1], recvBuffer[i + 2])));
+    CH_STOP(t2);
   }
-
-  delete[] recvBuffer;
-  delete[] offsets;
-  delete[] sendCounts;
-  delete[] mySendBuffer;
-
-  CH_STOP(t2);
 #endif
 
   // Ensure proper nesting by adding coarsened tiles from the fine level. We grow by one tile (one the fine level) in order
-  // to ensure that we're nesting correctly.
+  // to ensure that we're nesting correctly. In distributed mode a_fineTiles only contain the fine-level tiles owned by this rank,
+  // and the coarse tiles we generate here are sent to their owners below.
   CH_START(t3);
 
   const Box tileBoxFine = refine(tileBox, a_refToFine);
@@ -201,6 +218,225 @@ TiledMeshRefine::makeLevelTiles(TileSet&             a_tiles,
   }
 
   CH_STOP(t3);
+
+  // Send the tiles to the ranks that own them.
+  if (m_distributed) {
+    CH_START(t4);
+    this->distributeTiles(a_tiles);
+    CH_STOP(t4);
+  }
+}
+
+int
+TiledMeshRefine::getTileOwner(const Tile& a_tile) const noexcept
+{
+  // Mix all but the last index through a 64-bit hash (splitmix64 finalizer) so that neighboring tile rows end up on different ranks.
+  uint64_t hash = 0x9E3779B97F4A7C15ULL;
+
+  for (int dir = 0; dir < SpaceDim - 1; dir++) {
+    hash ^= static_cast<uint64_t>(static_cast<uint32_t>(a_tile[dir])) + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    hash = hash ^ (hash >> 31);
+  }
+
+  return static_cast<int>(hash % static_cast<uint64_t>(numProc()));
+}
+
+void
+TiledMeshRefine::distributeTiles(TileSet& a_tiles) const noexcept
+{
+  CH_TIME("TiledMeshRefine::distributeTiles");
+
+#ifdef CH_MPI
+  const int myRank = procID();
+
+  // Linearize the tiles into per-rank send buffers. Tiles that we already own are kept.
+  std::map<int, std::vector<int>> sendBuffers;
+
+  TileSet myTiles;
+
+  for (const auto& tile : a_tiles) {
+    const int owner = this->getTileOwner(tile);
+
+    if (owner == myRank) {
+      myTiles.emplace(tile);
+    }
+    else {
+      std::vector<int>& buffer = sendBuffers[owner];
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        buffer.emplace_back(tile[dir]);
+      }
+    }
+  }
+
+  a_tiles = std::move(myTiles);
+
+  // Sparse data exchange using the non-blocking consensus algorithm (synchronous sends + non-blocking barrier). This avoids an all-to-all
+  // exchange of the message sizes, so the communication volume only scales with the number of ranks that we actually talk to.
+  //
+  // A rank can leave the consensus loop and post the sends for the next level while other ranks are still probing for messages on this
+  // level. Each call therefore runs on its own duplicated communicator, so that messages from different calls can never be matched
+  // against each other.
+  constexpr int tag = 7411;
+
+  MPI_Comm comm;
+  MPI_Comm_dup(Chombo_MPI::comm, &comm);
+
+  std::vector<MPI_Request> sendRequests;
+  sendRequests.reserve(sendBuffers.size());
+
+  for (auto& buffer : sendBuffers) {
+    sendRequests.emplace_back(MPI_REQUEST_NULL);
+
+    MPI_Issend(&(buffer.second[0]), buffer.second.size(), MPI_INT, buffer.first, tag, comm, &sendRequests.back());
+  }
+
+  MPI_Request barrierRequest = MPI_REQUEST_NULL;
+
+  bool barrierActive = false;
+  bool done          = false;
+
+  std::vector<int> recvBuffer;
+
+  while (!done) {
+    int        hasMessage = 0;
+    MPI_Status status;
+
+    MPI_Iprobe(MPI_ANY_SOURCE, tag, comm, &hasMessage, &status);
+
+    if (hasMessage) {
+      int count = 0;
+      MPI_Get_count(&status, MPI_INT, &count);
+
+      recvBuffer.resize(count);
+      MPI_Recv(&recvBuffer[0], count, MPI_INT, status.MPI_SOURCE, tag, comm, MPI_STATUS_IGNORE);
+
+      for (int i = 0; i < count; i += SpaceDim) {
+        a_tiles.emplace(Tile(D_DECL(recvBuffer[i], recvBuffer[i + 1], recvBuffer[i + 2])));
+      }
+    }
+
+    if (barrierActive) {
+      int barrierDone = 0;
+      MPI_Test(&barrierRequest, &barrierDone, MPI_STATUS_IGNORE);
+
+      done = (barrierDone != 0);
+    }
+    else {
+      int sendsDone = 1;
+      if (sendRequests.size() > 0) {
+        MPI_Testall(sendRequests.size(), &sendRequests[0], &sendsDone, MPI_STATUSES_IGNORE);
+      }
+
+      if (sendsDone) {
+        MPI_Ibarrier(comm, &barrierRequest);
+
+        barrierActive = true;
+      }
+    }
+  }
+
+  MPI_Comm_free(&comm);
+#endif
+}
+
+void
+TiledMeshRefine::gatherTiles(std::vector<Tile>& a_allTiles, const TileSet& a_myTiles) const noexcept
+{
+  CH_TIME("TiledMeshRefine::gatherTiles");
+
+  a_allTiles.resize(0);
+
+  // Run-length encode the tiles along the last coordinate direction. The tile set is sorted lexicographically so consecutive
+  // tiles in the same row appear one after another.
+  std::vector<TileRun> myRuns;
+
+  for (const auto& tile : a_myTiles) {
+    bool extendsRun = false;
+
+    if (myRuns.size() > 0) {
+      TileRun& run = myRuns.back();
+
+      extendsRun = true;
+      for (int dir = 0; dir < SpaceDim - 1; dir++) {
+        extendsRun = extendsRun && (run[dir] == tile[dir]);
+      }
+      extendsRun = extendsRun && (run[SpaceDim - 1] + run[SpaceDim] == tile[SpaceDim - 1]);
+
+      if (extendsRun) {
+        run[SpaceDim]++;
+      }
+    }
+
+    if (!extendsRun) {
+      TileRun run;
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        run[dir] = tile[dir];
+      }
+      run[SpaceDim] = 1;
+
+      myRuns.emplace_back(run);
+    }
+  }
+
+  std::vector<TileRun> allRuns;
+
+#ifdef CH_MPI
+  constexpr int runSize = SpaceDim + 1;
+
+  const int mySendCount = myRuns.size() * runSize;
+
+  std::vector<int> sendBuffer(mySendCount);
+  std::vector<int> recvCounts(numProc());
+  std::vector<int> offsets(numProc());
+
+  for (size_t i = 0; i < myRuns.size(); i++) {
+    for (int j = 0; j < runSize; j++) {
+      sendBuffer[i * runSize + j] = myRuns[i][j];
+    }
+  }
+
+  MPI_Allgather(&mySendCount, 1, MPI_INT, &recvCounts[0], 1, MPI_INT, Chombo_MPI::comm);
+
+  int recvCount = 0;
+  for (int i = 0; i < numProc(); i++) {
+    offsets[i] = recvCount;
+    recvCount += recvCounts[i];
+  }
+
+  std::vector<int> recvBuffer(recvCount);
+
+  MPI_Allgatherv(mySendCount > 0 ? &sendBuffer[0] : nullptr,
+                 mySendCount,
+                 MPI_INT,
+                 recvCount > 0 ? &recvBuffer[0] : nullptr,
+                 &recvCounts[0],
+                 &offsets[0],
+                 MPI_INT,
+                 Chombo_MPI::comm);
+
+  allRuns.resize(recvCount / runSize);
+  for (size_t i = 0; i < allRuns.size(); i++) {
+    for (int j = 0; j < runSize; j++) {
+      allRuns[i][j] = recvBuffer[i * runSize + j];
+    }
+  }
+#else
+  allRuns = myRuns;
+#endif
+
+  // Decode the runs.
+  for (const auto& run : allRuns) {
+    Tile tile(D_DECL(run[0], run[1], run[2]));
+
+    for (int i = 0; i < run[SpaceDim]; i++) {
+      a_allTiles.emplace_back(tile);
+
+      tile[SpaceDim - 1]++;
+    }
+  }
 }
 
 void
@@ -227,4 +463,26 @@ TiledMeshRefine::makeBoxesFromTiles(Vector<Box>&         a_boxes,
   }
 }
 
+void
+TiledMeshRefine::makeBoxesFromTiles(Vector<Box>&             a_boxes,
+                                    const std::vector<Tile>& a_tiles,
+                                    const ProblemDomain&     a_domain) const noexcept
+{
+  CH_TIME("TiledMeshRefine::makeBoxesFromTiles");
+
+  a_boxes.resize(0);
+
+  const IntVect probLo = a_domain.domainBox().smallEnd();
+
+  for (const auto& tile : a_tiles) {
+    IntVect boxLo = probLo;
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      boxLo[dir] += tile[dir] * m_tileSize[dir];
+    }
+    const IntVect boxHi = boxLo + m_tileSize - IntVect::Unit;
+
+    a_boxes.push_back(Box(boxLo, boxHi));
+  }
+}
+
 #include <CD_NamespaceFooter.H>
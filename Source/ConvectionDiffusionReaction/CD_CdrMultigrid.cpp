@@ -70,6 +70,9 @@ CdrMultigrid::preRegrid(const int a_lbase, const int a_oldFinestLevel)
 
   CdrSolver::preRegrid(a_lbase, a_oldFinestLevel);
 
+  // The Krylov solver holds the operators of the old grids.
+  m_krylovSolver.freeMem();
+
   m_hasMultigridSolver = false;
 }
 
@@ -233,7 +236,7 @@ CdrMultigrid::advanceEuler(EBAMRCellData&       a_newPhi,
     DataOps::copy(a_newPhi, a_oldPhi);
 
     // Do the multigrid solve.
-    m_multigridSolver->solveNoInitResid(newPhi, resid, eulerRHS, finestLevel, coarsestLevel, false);
+    this->solveHelmholtz(newPhi, resid, eulerRHS, finestLevel);
   }
   else {
     DataOps::copy(a_newPhi, a_oldPhi);
@@ -332,7 +335,7 @@ CdrMultigrid::advanceCrankNicholson(EBAMRCellData&       a_newPhi,
     DataOps::copy(a_newPhi, a_oldPhi);
 
     // Do the multigrid solve.
-    m_multigridSolver->solveNoInitResid(newPhi, resid, eulerRHS, finestLevel, coarsestLevel, false);
+    this->solveHelmholtz(newPhi, resid, eulerRHS, finestLevel);
   }
   else {
     DataOps::copy(a_newPhi, a_oldPhi);
@@ -426,7 +429,8 @@ CdrMultigrid::setupHelmholtzFactory()
                              ghostRhs,
                              m_smoother,
                              bottomDomain,
-                             m_amr->getMaxBoxSize()));
+                             m_amr->getMaxBoxSize(),
+                             m_multigridAgglomeration));
 }
 
 void
@@ -519,6 +523,83 @@ CdrMultigrid::setupMultigrid()
 
   // Init solver. This instantiates all the operators in AMRMultiGrid so we can just call "solve"
   m_multigridSolver->init(phi, rhs, finestLevel, 0);
+
+  // Set up the outer Krylov solver (if we use one).
+  this->setupKrylovSolver();
+}
+
+void
+CdrMultigrid::setupKrylovSolver()
+{
+  CH_TIME("CdrMultigrid::setupKrylovSolver()");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::setupKrylovSolver()" << endl;
+  }
+
+  CH_assert(!m_multigridSolver.isNull());
+
+  switch (m_outerSolverType) {
+  case OuterSolverType::Multigrid: {
+    m_krylovSolver.freeMem();
+
+    break;
+  }
+  case OuterSolverType::GMRES:
+  case OuterSolverType::BiCGStab: {
+    const auto krylovType = (m_outerSolverType == OuterSolverType::GMRES) ? AmrKrylovSolver<EBCellFAB>::Type::GMRES
+                                                                          : AmrKrylovSolver<EBCellFAB>::Type::BiCGStab;
+
+    m_krylovSolver = RefCountedPtr<AmrKrylovSolver<EBCellFAB>>(
+      new AmrKrylovSolver<EBCellFAB>(m_multigridSolver, m_amr->getValidCells(m_realm)));
+
+    m_krylovSolver->setSolverParameters(krylovType,
+                                        m_multigridMaxIterations,
+                                        m_gmresRestart,
+                                        m_multigridExitTolerance,
+                                        m_multigridVerbosity);
+
+    break;
+  }
+  default: {
+    MayDay::Error("CdrMultigrid::setupKrylovSolver() - logic bust in outer solver selection");
+
+    break;
+  }
+  }
+}
+
+void
+CdrMultigrid::solveHelmholtz(Vector<LevelData<EBCellFAB>*>&       a_phi,
+                             Vector<LevelData<EBCellFAB>*>&       a_resid,
+                             const Vector<LevelData<EBCellFAB>*>& a_rhs,
+                             const int                            a_finestLevel)
+{
+  CH_TIME("CdrMultigrid::solveHelmholtz");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::solveHelmholtz" << endl;
+  }
+
+  constexpr int  coarsestLevel = 0;
+  constexpr bool zeroPhi       = false;
+
+  switch (m_outerSolverType) {
+  case OuterSolverType::Multigrid: {
+    m_multigridSolver->solveNoInitResid(a_phi, a_resid, a_rhs, a_finestLevel, coarsestLevel, zeroPhi);
+
+    break;
+  }
+  case OuterSolverType::GMRES:
+  case OuterSolverType::BiCGStab: {
+    m_krylovSolver->solve(a_phi, a_rhs, a_finestLevel, zeroPhi);
+
+    break;
+  }
+  default: {
+    MayDay::Error("CdrMultigrid::solveHelmholtz - logic bust");
+
+    break;
+  }
+  }
 }
 
 void
@@ -753,10 +834,43 @@ CdrMultigrid::parseMultigridSettings()
     MayDay::Error("CdrMultigrid::parseMultigridSettings - unknown cycle type requested");
   }
 
+  // Outer solver. Defaults to standalone multigrid. With 'gmres' or 'bicgstab' a V-cycle is used as preconditioner for a Krylov method.
+  str               = "multigrid";
+  m_gmresRestart    = 16;
+  m_outerSolverType = OuterSolverType::Multigrid;
+
+  pp.query("gmg_outer_solver", str);
+  pp.query("gmg_gmres_restart", m_gmresRestart);
+
+  if (str == "multigrid") {
+    m_outerSolverType = OuterSolverType::Multigrid;
+  }
+  else if (str == "gmres") {
+    m_outerSolverType = OuterSolverType::GMRES;
+  }
+  else if (str == "bicgstab") {
+    m_outerSolverType = OuterSolverType::BiCGStab;
+  }
+  else {
+    MayDay::Error("CdrMultigrid::parseMultigridSettings - unknown outer solver requested");
+  }
+
+  // Agglomeration of the multigrid levels below the coarsest AMR level onto fewer ranks. Defaults to no agglomeration.
+  m_multigridAgglomeration = 0;
+
+  pp.query("gmg_agglomerate", m_multigridAgglomeration);
+
   // No lower than 2.
   if (m_minCellsBottom < 2) {
     m_minCellsBottom = 2;
   }
+
+  CH_assert(m_gmresRestart > 0);
+
+  // The outer solver settings can change without rebuilding the multigrid hierarchy.
+  if (m_hasMultigridSolver) {
+    this->setupKrylovSolver();
+  }
 }
 
 #include <CD_NamespaceFooter.H>
@@ -34,6 +34,7 @@
 #include <CD_Units.H>
 #include <CD_MemoryReport.H>
 #include <CD_Timer.H>
+#include <CD_Tracer.H>
 #include <CD_ParallelOps.H>
 #include <CD_DischargeIO.H>
 #include <CD_OpenMP.H>
@@ -66,8 +67,10 @@ Driver::Driver(const RefCountedPtr<ComputationalGeometry>& a_computationalGeomet
   m_dt       = 0.0;
   m_outputDt = -1.0;
 
-  m_profile      = false;
-  m_doCoarsening = true;
+  m_profile        = false;
+  m_doCoarsening   = true;
+  m_traceFirstStep = -1;
+  m_traceLastStep  = -1;
 
   // Parse some class options and create the output directories for the simulation.
   this->parseOptions();
@@ -567,13 +570,22 @@ Driver::gridReport()
                            finestLevel,
                            m_amr->getGrids(str));
 
+    // Stencil reuse in the most recent regrid.
+    const IrregStencilCache::Statistics stencilCache = m_amr->getStencilCacheStatistics(str);
+
+    const long long numPatches = stencilCache.m_hits + stencilCache.m_misses;
+    const Real      hitRate    = (numPatches > 0) ? (100.0 * stencilCache.m_hits) / numPatches : 0.0;
+
     pout() << "\t**************" << endl
            << "\tRealm = " << str << endl
            << "\t...Proc. # of valid cells... = " << DischargeIO::numberFmt(localCells) << endl
            << "\t...Including ghost cells.... = " << DischargeIO::numberFmt(localCellsGhosts) << endl
            << "\t...Proc. # of boxes......... = " << DischargeIO::numberFmt(localBoxes) << endl
            << "\t...Proc. # of boxes (lvl)... = " << DischargeIO::numberFmt(localLevelBoxes) << endl
-           << "\t...Proc. # of cells (lvl)... = " << DischargeIO::numberFmt(localLevelCells) << endl;
+           << "\t...Proc. # of cells (lvl)... = " << DischargeIO::numberFmt(localLevelCells) << endl
+           << "\t...Stencil cache hits....... = " << stencilCache.m_hits << "/" << numPatches << " (" << hitRate
+           << "%)" << endl
+           << "\t...Stencil time saved (s)... = " << stencilCache.m_savedTime << endl;
   }
 
   // Write a memory report if Chombo was to compiled to use memory tracking.
@@ -611,6 +623,7 @@ void
 Driver::regrid(const int a_lmin, const int a_lmax, const bool a_useInitialData)
 {
   CH_TIMERS("Driver::regrid");
+  CD_TRACE("Driver::regrid");
   CH_TIMER("Driver::regrid::compact_tags", t1);
   if (m_verbosity > 2) {
     pout() << "Driver::regrid" << endl;
@@ -911,9 +924,18 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
 
       // Time stepper advances solutions. Note that the time stepper can choose to use a time step different
       // from the one we computed (because some time-steppers use adaptive time-stepping).
-      m_wallClockOne      = Timer::wallClock();
-      const Real actualDt = m_timeStepper->advance(m_dt);
-      m_wallClockTwo      = Timer::wallClock();
+      if (m_traceFirstStep >= 0 && m_timeStep == m_traceFirstStep) {
+        Tracer::enable(true);
+      }
+
+      m_wallClockOne = Timer::wallClock();
+      Real actualDt;
+      {
+        CD_TRACE("TimeStepper::advance");
+
+        actualDt = m_timeStepper->advance(m_dt);
+      }
+      m_wallClockTwo = Timer::wallClock();
 
       // Synchronize times
       m_dt = actualDt;
@@ -921,6 +943,9 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
       m_timeStep += 1;
       m_timeStepper->synchronizeSolverTimes(m_timeStep, m_time, m_dt);
 
+      // Free scratch data that the time step did not need.
+      m_amr->trimScratchPools();
+
       // Check if this was the last step.
       if (std::abs(m_time - a_endTime) < m_dt * 1.E-5) {
         isLastStep = true;
@@ -972,6 +997,11 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
       }
 #endif
 
+      // Write the trace if we reached the end of the tracing window.
+      if (Tracer::isEnabled() && (m_timeStep > m_traceLastStep || isLastStep)) {
+        this->writeTrace();
+      }
+
       // Rebuild the ParmParse table and read input parameters again. Some parameters are allowed to change during runtime.
       this->rebuildParmParse();
 
@@ -984,6 +1014,11 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
     }
   }
 
+  // Flush the trace if the run ended inside the tracing window.
+  if (Tracer::isEnabled()) {
+    this->writeTrace();
+  }
+
   if (m_verbosity > 0) {
     pout() << "==================================" << endl;
     pout() << "Driver::run -- ending run  " << endl;
@@ -1127,6 +1162,20 @@ Driver::parseOptions()
 
   // Not a required thing.
   pp.query("coarsening", m_doCoarsening);
+
+  // Tracing window. Not required either.
+  int traceCapacity = -1;
+
+  pp.query("trace_first_step", m_traceFirstStep);
+  pp.query("trace_last_step", m_traceLastStep);
+  pp.query("trace_capacity", traceCapacity);
+
+  if (m_traceFirstStep >= 0 && m_traceLastStep < m_traceFirstStep) {
+    MayDay::Error("Driver::parseOptions - 'trace_last_step' can not be smaller than 'trace_first_step'");
+  }
+  if (traceCapacity > 0) {
+    Tracer::setCapacity(traceCapacity);
+  }
 }
 
 void
@@ -1326,6 +1375,12 @@ Driver::createOutputDirectories()
       std::cout << "Driver::createOutputDirectories - master could not create mpi/loads directory" << std::endl;
     }
 
+    cmd     = "mkdir -p " + m_outputDirectory + "/mpi/traces";
+    success = system(cmd.c_str());
+    if (success != 0) {
+      std::cout << "Driver::createOutputDirectories - master could not create mpi/traces directory" << std::endl;
+    }
+
     cmd     = "mkdir -p " + m_outputDirectory + "/regrid";
     success = system(cmd.c_str());
     if (success != 0) {
@@ -1845,6 +1900,22 @@ Driver::stepReport(const Real a_startTime, const Real a_endTime, const int a_max
   sprintf(metrics, "%31c -- Estimated remaining   : %3.3ih %2.2im %2.2is %3.3ims", ' ', remHrs, remMin, remSec, remMs);
   pout() << metrics << endl;
 
+  // Scratch data reuse since the last step report.
+  long numScratchHits   = 0L;
+  long numScratchMisses = 0L;
+  Real scratchSavedTime = 0.0;
+
+  m_amr->getScratchStatistics(numScratchHits, numScratchMisses, scratchSavedTime);
+  m_amr->resetScratchStatistics();
+
+  sprintf(metrics,
+          "%31c -- Scratch data reuse    : %ld hits, %ld misses, ~%3.3ims allocation time saved",
+          ' ',
+          numScratchHits,
+          numScratchMisses,
+          int(std::floor(scratchSavedTime * 1000)));
+  pout() << metrics << endl;
+
   // Write memory usage
 #ifdef CH_USE_MEMORY_TRACKING
   const Real bytesPerMB = 1024. * 1024.;
@@ -2094,6 +2165,27 @@ Driver::writeComputationalLoads()
 #endif
 }
 
+void
+Driver::writeTrace()
+{
+  CH_TIME("Driver::writeTrace()");
+  if (m_verbosity > 3) {
+    pout() << "Driver::writeTrace()" << endl;
+  }
+
+  // TLDR: This stops tracing and writes one trace file per rank, which can be loaded (together) into chrome://tracing or
+  //       https://ui.perfetto.dev. The summary is reduced over all ranks and written to pout.
+  Tracer::enable(false);
+
+  char              file_char[1000];
+  const std::string prefix = m_outputDirectory + "/mpi/traces/" + m_outputFileNames;
+  sprintf(file_char, "%s.trace.step%07d.rank%05d.%dd.json", prefix.c_str(), m_timeStep, procID(), SpaceDim);
+  std::string fname(file_char);
+
+  Tracer::writeChromeTrace(fname);
+  Tracer::report(pout());
+}
+
 void
 Driver::writeGeometry()
 {
@@ -2240,6 +2332,7 @@ void
 Driver::writePlotFile(const std::string a_filename)
 {
   CH_TIMERS("Driver::writePlotFile(string)");
+  CD_TRACE("Driver::writePlotFile");
   CH_TIMER("Driver::writePlotFile::allocate", t1);
   CH_TIMER("Driver::writePlotFile::assemble", t2);
   CH_TIMER("Driver::writePlotFile::interp_exchange", t3);
@@ -2540,6 +2633,7 @@ void
 Driver::writeCheckpointFile()
 {
   CH_TIME("Driver::writeCheckpointFile()");
+  CD_TRACE("Driver::writeCheckpointFile");
   if (m_verbosity >= 1) {
     pout() << "Driver::writeCheckpointFile()" << endl;
   }
@@ -39,6 +39,8 @@ FieldSolver::FieldSolver()
   m_realm        = Realm::Primal;
   m_isVoltageSet = false;
   m_regridSlopes = true;
+  m_reportCycles = false;
+  m_numCycles    = -1;
   m_verbosity    = -1;
 
   this->setDataLocation(Location::Cell::Center);
@@ -415,6 +417,13 @@ FieldSolver::regrid(const int a_lmin, const int a_oldFinestLevel, const int a_ne
   m_amr->conservativeAverage(m_potential, m_realm);
   m_amr->interpGhost(m_potential, m_realm);
 
+  // The stored solutions still live on the old grids, so they are regridded in the same way as the potential.
+  m_solutionHistory.remap([&](MFAMRCellData& a_newData, const MFAMRCellData& a_oldData) -> void {
+    m_amr->allocate(a_newData, m_realm, m_nComp);
+    m_amr->interpToNewGrids(a_newData, a_oldData, a_lmin, a_oldFinestLevel, a_newFinestLevel, interpType);
+    m_amr->conservativeAverage(a_newData, m_realm);
+  });
+
   // Recompute E from the new potential.
   this->computeElectricField();
 
@@ -642,6 +651,68 @@ FieldSolver::parseRegridSlopes()
   pp.get("use_regrid_slopes", m_regridSlopes);
 }
 
+void
+FieldSolver::parseInitialGuess()
+{
+  CH_TIME("FieldSolver::parseInitialGuess()");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolver::parseInitialGuess()" << endl;
+  }
+
+  ParmParse pp(m_className.c_str());
+
+  int historyLength = 0;
+
+  m_reportCycles = false;
+
+  pp.query("guess_history", historyLength);
+  pp.query("report_cycles", m_reportCycles);
+
+  if (historyLength == 1 || historyLength < 0) {
+    MayDay::Warning("FieldSolver::parseInitialGuess - 'guess_history' must be 0 (off) or >= 2 (turning it off)");
+
+    historyLength = 0;
+  }
+
+  // Don't discard the stored solutions if the options are re-read with the same history length.
+  if (historyLength != m_solutionHistory.getMaxSize()) {
+    m_solutionHistory.define(historyLength);
+  }
+}
+
+bool
+FieldSolver::extrapolateInitialGuess(MFAMRCellData& a_phi, const bool a_zeroPhi)
+{
+  CH_TIME("FieldSolver::extrapolateInitialGuess(MFAMRCellData, bool)");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolver::extrapolateInitialGuess(MFAMRCellData, bool)" << endl;
+  }
+
+  bool extrapolated = false;
+
+  // Only the solver's own potential has a history.
+  if (&a_phi == &m_potential && !a_zeroPhi) {
+    extrapolated = m_solutionHistory.extrapolate(a_phi, m_timeStep, m_time);
+  }
+
+  return extrapolated;
+}
+
+void
+FieldSolver::storeSolution(const MFAMRCellData& a_phi)
+{
+  CH_TIME("FieldSolver::storeSolution(MFAMRCellData)");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolver::storeSolution(MFAMRCellData)" << endl;
+  }
+
+  if (&a_phi == &m_potential) {
+    m_solutionHistory.store(a_phi, m_timeStep, m_time, [&](MFAMRCellData& a_data) -> void {
+      m_amr->allocate(a_data, m_realm, m_nComp);
+    });
+  }
+}
+
 std::string
 FieldSolver::makeBcString(const int a_dir, const Side::LoHiSide a_side) const
 {
@@ -1718,4 +1789,12 @@ FieldSolver::getPermittivityEB()
   return m_permittivityEB;
 }
 
+int
+FieldSolver::getNumCycles() const noexcept
+{
+  CH_TIME("FieldSolver::getNumCycles()");
+
+  return m_numCycles;
+}
+
 #include <CD_NamespaceFooter.H>
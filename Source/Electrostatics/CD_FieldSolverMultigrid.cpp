@@ -57,6 +57,7 @@ FieldSolverMultigrid::parseOptions()
   this->parseKappaSource();
   this->parseJumpBC();
   this->parseRegridSlopes();
+  this->parseInitialGuess();
 }
 
 void
@@ -72,6 +73,12 @@ FieldSolverMultigrid::parseRuntimeOptions()
   this->parseKappaSource();
   this->parsePlotVariables();
   this->parseRegridSlopes();
+  this->parseInitialGuess();
+
+  // The outer solver settings can change without rebuilding the multigrid hierarchy.
+  if (m_isSolverSetup) {
+    this->setupKrylovSolver();
+  }
 }
 
 void
@@ -124,9 +131,12 @@ FieldSolverMultigrid::parseMultigridSettings()
     else if (str == "gmres") {
       m_bottomSolverType = BottomSolverType::GMRES;
     }
+    else if (str == "direct") {
+      m_bottomSolverType = BottomSolverType::Direct;
+    }
     else {
       MayDay::Error(
-        "FieldSolverMultigrid::parseMultigridSettings() - logic bust, you've specified one parameter and I expected either 'bicgstab' or 'gmres'");
+        "FieldSolverMultigrid::parseMultigridSettings() - logic bust, you've specified one parameter and I expected 'bicgstab', 'gmres', or 'direct'");
     }
   }
   else if (num == 2) {
@@ -144,7 +154,7 @@ FieldSolverMultigrid::parseMultigridSettings()
   }
   else {
     MayDay::Error(
-      "FieldSolverMultigrid::parseMultigridSettings() - logic bust in bottom solver. You must specify ' = bicgstab', ' = gmres', or ' = simple <number>'");
+      "FieldSolverMultigrid::parseMultigridSettings() - logic bust in bottom solver. You must specify ' = bicgstab', ' = gmres', ' = direct', or ' = simple <number>'");
   }
 
   // Get a string for the multigrid smoother. This must either be "jacobi", "red_black", or "multi_color".
@@ -172,6 +182,33 @@ FieldSolverMultigrid::parseMultigridSettings()
       "FieldSolverMultigrid::parseMultigridSettings - unsupported multigrid cycle type requested. Only vcycle supported for now. ");
   }
 
+  // Outer solver. Defaults to standalone multigrid. With 'gmres' or 'bicgstab' a V-cycle is used as preconditioner for a Krylov method.
+  str               = "multigrid";
+  m_gmresRestart    = 16;
+  m_outerSolverType = OuterSolverType::Multigrid;
+
+  pp.query("gmg_outer_solver", str);
+  pp.query("gmg_gmres_restart", m_gmresRestart);
+
+  if (str == "multigrid") {
+    m_outerSolverType = OuterSolverType::Multigrid;
+  }
+  else if (str == "gmres") {
+    m_outerSolverType = OuterSolverType::GMRES;
+  }
+  else if (str == "bicgstab") {
+    m_outerSolverType = OuterSolverType::BiCGStab;
+  }
+  else {
+    MayDay::Error(
+      "FieldSolverMultigrid::parseMultigridSettings - unsupported outer solver requested. Use 'multigrid', 'gmres', or 'bicgstab'");
+  }
+
+  // Agglomeration of the multigrid levels below the coarsest AMR level onto fewer ranks. Defaults to no agglomeration.
+  m_multigridAgglomeration = 0;
+
+  pp.query("gmg_agglomerate", m_multigridAgglomeration);
+
   // No lower than 2.
   if (m_minCellsBottom < 2) {
     m_minCellsBottom = 2;
@@ -186,6 +223,7 @@ FieldSolverMultigrid::parseMultigridSettings()
   CH_assert(m_multigridBcWeight >= 0);
   CH_assert(m_multigridJumpOrder > 0);
   CH_assert(m_multigridJumpWeight >= 0);
+  CH_assert(m_gmresRestart > 0);
 }
 
 void
@@ -271,6 +309,9 @@ FieldSolverMultigrid::solve(MFAMRCellData&       a_phi,
     DataOps::kappaScale(kappaRhoByEps0);
   }
 
+  // Start from an extrapolation of the previous solutions if we have them.
+  this->extrapolateInitialGuess(a_phi, a_zeroPhi);
+
   m_amr->conservativeAverage(a_phi, m_realm);
   m_amr->interpGhost(a_phi, m_realm);
   m_amr->arithmeticAverage(kappaRhoByEps0, m_realm);
@@ -309,14 +350,21 @@ FieldSolverMultigrid::solve(MFAMRCellData&       a_phi,
   // Convergence criterion.
   const Real convergedResid = zeroResid * m_multigridExitTolerance;
 
+  m_countingBottomSolver->resetCount();
+
   // If the residue rho - L(phi) is too large then we must get a new solution.
   if (phiResid > convergedResid) {
-    m_multigridSolver->m_convergenceMetric = zeroResid;
-    m_multigridSolver->solveNoInitResid(phi, res, rhs, finestLevel, coarsestLevel, a_zeroPhi);
-
-    const int status = m_multigridSolver->m_exitStatus; // 1 => Initial norm sufficiently reduced
-    if (status == 1 || status == 8) {                   // 8 => Norm sufficiently small
-      converged = true;
+    if (m_outerSolverType == OuterSolverType::Multigrid) {
+      m_multigridSolver->m_convergenceMetric = zeroResid;
+      m_multigridSolver->solveNoInitResid(phi, res, rhs, finestLevel, coarsestLevel, a_zeroPhi);
+
+      const int status = m_multigridSolver->m_exitStatus; // 1 => Initial norm sufficiently reduced
+      if (status == 1 || status == 8) {                   // 8 => Norm sufficiently small
+        converged = true;
+      }
+    }
+    else {
+      converged = m_krylovSolver->solve(phi, rhs, finestLevel, a_zeroPhi);
     }
   }
   else {
@@ -329,6 +377,14 @@ FieldSolverMultigrid::solve(MFAMRCellData&       a_phi,
   m_amr->conservativeAverage(a_phi, m_realm);
   m_amr->interpGhostPwl(a_phi, m_realm);
 
+  m_numCycles = m_countingBottomSolver->getCount();
+
+  if (m_reportCycles) {
+    pout() << "FieldSolverMultigrid::solve - step = " << m_timeStep << ", cycles = " << m_numCycles << endl;
+  }
+
+  this->storeSolution(a_phi);
+
   this->computeElectricField(m_electricField, a_phi);
 
   // If we are also solving for the saturation charge we get that solution from the factory (it can be a free parameter in the Helmholtz solve).
@@ -353,7 +409,9 @@ FieldSolverMultigrid::preRegrid(const int a_lbase, const int a_oldFinestLevel)
 
   FieldSolver::preRegrid(a_lbase, a_oldFinestLevel);
 
+  m_krylovSolver.freeMem();
   m_multigridSolver.freeMem();
+  m_countingBottomSolver.freeMem();
   m_helmholtzOpFactory.freeMem();
 }
 
@@ -455,6 +513,9 @@ FieldSolverMultigrid::setSolverPermittivities(const MFAMRCellData& a_permittivit
       op.setAcoAndBco(op.getAcoef(), op.getBcoef(), op.getBcoefIrreg());
     }
   }
+
+  // The bottom-level operator changed, so the direct bottom solver must refactorize.
+  m_directSolver.invalidate();
 }
 
 void
@@ -524,6 +585,8 @@ FieldSolverMultigrid::setPermittivities()
 
     m_amr->average(permFluxSol, m_realm, phase::solid, average);
   }
+
+  m_directSolver.invalidate();
 }
 
 void
@@ -657,7 +720,8 @@ FieldSolverMultigrid::setupHelmholtzFactory()
                              bottomDomain,
                              m_multigridJumpOrder,
                              m_multigridJumpWeight,
-                             m_amr->getMaxBoxSize()));
+                             m_amr->getMaxBoxSize(),
+                             m_multigridAgglomeration));
 }
 
 void
@@ -689,6 +753,13 @@ FieldSolverMultigrid::setupMultigrid()
 
     break;
   }
+  case BottomSolverType::Direct: {
+    m_directSolver.setVerbose(m_verbosity > 5);
+
+    bottomSolver = &m_directSolver;
+
+    break;
+  }
   default: {
     MayDay::Error("FieldSolverMultigrid::setupMultigrid - logic bust in bottom solver");
 
@@ -720,9 +791,12 @@ FieldSolverMultigrid::setupMultigrid()
   const int           finestLevel    = m_amr->getFinestLevel();
   const ProblemDomain coarsestDomain = m_amr->getDomains()[0];
 
+  m_countingBottomSolver = RefCountedPtr<CountingLinearSolver<LevelData<MFCellFAB>>>(
+    new CountingLinearSolver<LevelData<MFCellFAB>>(bottomSolver));
+
   // Define the Chombo multigrid solver
   m_multigridSolver = RefCountedPtr<AMRMultiGrid<LevelData<MFCellFAB>>>(new AMRMultiGrid<LevelData<MFCellFAB>>);
-  m_multigridSolver->define(coarsestDomain, *m_helmholtzOpFactory, bottomSolver, 1 + finestLevel);
+  m_multigridSolver->define(coarsestDomain, *m_helmholtzOpFactory, &(*m_countingBottomSolver), 1 + finestLevel);
   m_multigridSolver->setSolverParameters(m_multigridPreSmooth,
                                          m_multigridPostSmooth,
                                          m_multigridBottomSmooth,
@@ -758,6 +832,50 @@ FieldSolverMultigrid::setupMultigrid()
 
   // Init the solver. This instantiates the all the operators in AMRMultiGrid so we can just call "solve"
   m_multigridSolver->init(phi, rhs, finestLevel, 0);
+
+  // Set up the outer Krylov solver (if we use one).
+  this->setupKrylovSolver();
+}
+
+void
+FieldSolverMultigrid::setupKrylovSolver()
+{
+  CH_TIME("FieldSolverMultigrid::setupKrylovSolver()");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::setupKrylovSolver()" << endl;
+  }
+
+  // The Krylov solver uses the operators and V-cycle in m_multigridSolver, so this must be called after setupMultigrid.
+  CH_assert(!m_multigridSolver.isNull());
+
+  switch (m_outerSolverType) {
+  case OuterSolverType::Multigrid: {
+    m_krylovSolver.freeMem();
+
+    break;
+  }
+  case OuterSolverType::GMRES:
+  case OuterSolverType::BiCGStab: {
+    const auto krylovType = (m_outerSolverType == OuterSolverType::GMRES) ? AmrKrylovSolver<MFCellFAB>::Type::GMRES
+                                                                          : AmrKrylovSolver<MFCellFAB>::Type::BiCGStab;
+
+    m_krylovSolver = RefCountedPtr<AmrKrylovSolver<MFCellFAB>>(
+      new AmrKrylovSolver<MFCellFAB>(m_multigridSolver, m_amr->getValidCells(m_realm)));
+
+    m_krylovSolver->setSolverParameters(krylovType,
+                                        m_multigridMaxIterations,
+                                        m_gmresRestart,
+                                        m_multigridExitTolerance,
+                                        m_multigridVerbosity);
+
+    break;
+  }
+  default: {
+    MayDay::Error("FieldSolverMultigrid::setupKrylovSolver - logic bust in outer solver selection");
+
+    break;
+  }
+  }
 }
 
 Vector<long long>
@@ -100,13 +100,21 @@ EBHelmholtzOp::EBHelmholtzOp(const Location::Cell                             a_
   m_doInterpCF = true;
   m_doCoarsen  = true;
   m_doExchange = true;
-  m_refluxFree = false;
-  m_profile    = false;
-  m_interval   = Interval(m_comp, m_comp);
+  m_refluxFree       = false;
+  m_profile          = false;
+  m_overlapExchange  = true;
+  m_fusedRestrict    = true;
+  m_restrictTileSize = 8;
+  m_interval         = Interval(m_comp, m_comp);
 
   ParmParse pp("EBHelmholtzOp");
   pp.query("reflux_free", m_refluxFree);
   pp.query("profile", m_profile);
+  pp.query("overlap_exchange", m_overlapExchange);
+  pp.query("fused_restrict", m_fusedRestrict);
+  pp.query("restrict_tile_size", m_restrictTileSize);
+
+  m_restrictTileSize = std::max(1, m_restrictTileSize);
 
   m_timer = Timer("EBHelmholtzOp");
 
@@ -117,6 +125,9 @@ EBHelmholtzOp::EBHelmholtzOp(const Location::Cell                             a_
 
   m_exchangeCopier.exchangeDefine(m_eblg.getDBL(), a_ghostPhi);
 
+  // Interior and boundary regions for when we overlap exchanges with computation.
+  this->defineOverlapRegions();
+
   // If we are using a centroid discretization we must interpolate three ghost cells in the general case. Issue a warning if the
   // interpolator doesn't fill enough ghost cells.
   if (m_dataLocation == Location::Cell::Centroid && m_hasCoar) {
@@ -293,6 +304,8 @@ EBHelmholtzOp::defineStencils()
     m_vofIterDomLo[dir].define(dbl);
     m_vofIterDomHi[dir].define(dbl);
     m_centroidFluxStencil[dir].define(dbl);
+    m_centroidFluxCompiled[dir].define(dbl);
+    m_centroidFluxFaces[dir].define(dbl);
   }
 
   // Get the "colors" for multi-colored relaxation.
@@ -460,6 +473,16 @@ EBHelmholtzOp::defineStencils()
       };
 
       BoxLoops::loop(faceIt, kernel);
+
+      // Flatten the flux stencils.
+      std::vector<FaceIndex>& fluxFaces = m_centroidFluxFaces[dir][din];
+
+      fluxFaces.resize(0);
+      for (faceIt.reset(); faceIt.ok(); ++faceIt) {
+        fluxFaces.emplace_back(faceIt());
+      }
+
+      m_centroidFluxCompiled[dir][din].define(faceIt, fluxStencils, m_comp);
     }
 
     // 5. Add contributions to the operator from the EB faces.
@@ -732,14 +755,42 @@ EBHelmholtzOp::restrictResidual(LevelData<EBCellFAB>&       a_resCoar,
 {
   CH_TIME("EBHelmholtzOp::restrictResidual(LD<EBCellFAB>, LD<EBCellFAB>, LD<EBCellFAB>)");
 
+  if (m_profile) {
+    m_timer.startEvent("Restrict residual");
+  }
+
   // Compute the residual on this level first. Make a temporary for that.
   LevelData<EBCellFAB> res;
   this->create(res, a_phi);
-  this->setToZero(res);
-  this->residual(res, a_phi, a_rhs, true);
 
-  // Restrict it onto the coarse level.
-  m_restrictOpMG.restrictResidual(a_resCoar, res, m_interval);
+  if (m_fusedRestrict) {
+
+    // Fill the ghost cells and then compute + restrict the residual patch-by-patch.
+    if (m_doExchange) {
+      a_phi.exchange(m_exchangeCopier);
+    }
+
+    if (m_hasCoar && m_doInterpCF) {
+      this->interpolateCF(a_phi, nullptr, true);
+    }
+
+    auto fineKernel = [&](EBCellFAB& resCoar, const DataIndex& din) -> void {
+      this->restrictResidualKernel(resCoar, res[din], a_phi[din], a_rhs[din], din);
+    };
+
+    m_restrictOpMG.restrictResidual(a_resCoar, res, m_comp, fineKernel);
+  }
+  else {
+    this->setToZero(res);
+    this->residual(res, a_phi, a_rhs, true);
+
+    // Restrict it onto the coarse level.
+    m_restrictOpMG.restrictResidual(a_resCoar, res, m_interval);
+  }
+
+  if (m_profile) {
+    m_timer.stopEvent("Restrict residual");
+  }
 }
 
 void
@@ -1123,6 +1174,13 @@ EBHelmholtzOp::applyOp(LevelData<EBCellFAB>&             a_Lphi,
   // do a local copy, but that can end up being expensive since this is called on every relaxation.
   LevelData<EBCellFAB>& phi = (LevelData<EBCellFAB>&)a_phi;
 
+  // Split-phase version which does the computations in the patch interiors while the exchange is in progress.
+  if (m_overlapExchange && m_doExchange) {
+    this->applyOpOverlapped(a_Lphi, phi, a_phiCoar, a_homogeneousPhysBC, a_homogeneousCFBC, m_doInterpCF, nullptr);
+
+    return;
+  }
+
   if (m_doExchange) {
     phi.exchange(m_exchangeCopier);
   }
@@ -1204,34 +1262,171 @@ EBHelmholtzOp::applyOpRegular(EBCellFAB&             a_Lphi,
   this->applyDomainFlux(a_phi, a_Bcoef, a_cellBox, a_dit, a_homogeneousPhysBC);
   CH_STOP(t1);
 
+  CH_START(t2);
+  this->applyOpRegularKernel(a_Lphi, a_phi, a_Acoef, a_Bcoef, a_cellBox);
+  CH_STOP(t2);
+}
+
+inline Real
+EBHelmholtzOp::applyRegularStencil(const IntVect&                                a_iv,
+                                   const FArrayBox&                              a_phi,
+                                   const FArrayBox&                              a_Acoef,
+                                   const std::array<const FArrayBox*, SpaceDim>& a_Bcoef,
+                                   const Real                                    a_factor) const noexcept
+{
+  Real laplacian = 0.0;
+
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    const FArrayBox& bco = *a_Bcoef[dir];
+    const IntVect    ivp = a_iv + BASISV(dir);
+    const IntVect    ivm = a_iv - BASISV(dir);
+
+    laplacian += bco(ivp, m_comp) * (a_phi(ivp, m_comp) - a_phi(a_iv, m_comp));
+    laplacian -= bco(a_iv, m_comp) * (a_phi(a_iv, m_comp) - a_phi(ivm, m_comp));
+  }
+
+  return m_alpha * a_Acoef(a_iv, m_comp) * a_phi(a_iv, m_comp) + a_factor * laplacian;
+}
+
+void
+EBHelmholtzOp::applyOpRegularKernel(EBCellFAB&       a_Lphi,
+                                    const EBCellFAB& a_phi,
+                                    const EBCellFAB& a_Acoef,
+                                    const EBFluxFAB& a_Bcoef,
+                                    const Box&       a_computeBox) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::applyOpRegularKernel");
+
   FArrayBox&       Lphi = a_Lphi.getFArrayBox();
   const FArrayBox& phi  = a_phi.getFArrayBox();
   const FArrayBox& aco  = a_Acoef.getFArrayBox();
-  const FArrayBox& bcoX = a_Bcoef[0].getFArrayBox();
-  const FArrayBox& bcoY = a_Bcoef[1].getFArrayBox();
-#if CH_SPACEDIM == 3
-  const FArrayBox& bcoZ = a_Bcoef[2].getFArrayBox();
-#endif
+
+  std::array<const FArrayBox*, SpaceDim> bco;
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    bco[dir] = &(a_Bcoef[dir].getFArrayBox());
+  }
 
   // This is the C++ kernel. It adds the diagonal and the Laplacian part.
   const Real factor = m_beta / (m_dx * m_dx);
 
   auto kernel = [&](const IntVect& iv) -> void {
-    Lphi(iv, m_comp) = m_alpha * aco(iv, m_comp) * phi(iv, m_comp) +
-                       factor * (bcoX(iv + BASISV(0), m_comp) * (phi(iv + BASISV(0), m_comp) - phi(iv, m_comp)) -
-                                 bcoX(iv, m_comp) * (phi(iv, m_comp) - phi(iv - BASISV(0), m_comp)) +
-                                 bcoY(iv + BASISV(1), m_comp) * (phi(iv + BASISV(1), m_comp) - phi(iv, m_comp)) -
-                                 bcoY(iv, m_comp) * (phi(iv, m_comp) - phi(iv - BASISV(1), m_comp))
-#if CH_SPACEDIM == 3
-                                 + bcoZ(iv + BASISV(2), m_comp) * (phi(iv + BASISV(2), m_comp) - phi(iv, m_comp)) -
-                                 bcoZ(iv, m_comp) * (phi(iv, m_comp) - phi(iv - BASISV(2), m_comp))
-#endif
-                                );
+    Lphi(iv, m_comp) = this->applyRegularStencil(iv, phi, aco, bco, factor);
   };
 
   // Launch the kernel.
+  if (!(a_computeBox.isEmpty())) {
+    BoxLoops::loop(a_computeBox, kernel);
+  }
+}
+
+void
+EBHelmholtzOp::restrictResidualKernel(EBCellFAB&       a_resCoar,
+                                      EBCellFAB&       a_res,
+                                      EBCellFAB&       a_phi,
+                                      const EBCellFAB& a_rhs,
+                                      const DataIndex& a_dit) const noexcept
+{
+  CH_TIMERS("EBHelmholtzOp::restrictResidualKernel");
+  CH_TIMER("EBHelmholtzOp::restrictResidualKernel::regular_cells", t1);
+  CH_TIMER("EBHelmholtzOp::restrictResidualKernel::irregular_cells", t2);
+
+  // TLDR: This computes res = rhs - L(phi) and restricts it onto the coarsened patch. In the regular cells we traverse the patch in tiles of coarse
+  //       cells and compute the residual on the fine cells in each tile using the regular stencil. The residual is written to a_res and added
+  //       into the coarse cell in the same pass, so phi/rhs/coefficients are only read once and the coarse tile stays in cache. Once that is done
+  //       we overwrite the residual in the cells with explicit stencils and redo the restriction in the coarse cells that overlap them.
+
+  const Box      cellBox = m_eblg.getDBL()[a_dit];
+  const EBISBox& ebisbox = m_eblg.getEBISL()[a_dit];
+  const int      refRat  = m_restrictOpMG.getRefRat();
+  const Real     weight  = 1.0 / std::pow(refRat, SpaceDim);
+  const Box      coarBox = coarsen(cellBox, refRat);
+  const Box      refBox  = Box(IntVect::Zero, (refRat - 1) * IntVect::Unit);
+  const IntVect  tileLen = (m_restrictTileSize - 1) * IntVect::Unit;
+
+  const EBCellFAB& Acoef = (*m_Acoef)[a_dit];
+  const EBFluxFAB& Bcoef = (*m_Bcoef)[a_dit];
+
+  FArrayBox&       resCoar = a_resCoar.getFArrayBox();
+  FArrayBox&       res     = a_res.getFArrayBox();
+  const FArrayBox& phi     = a_phi.getFArrayBox();
+  const FArrayBox& rhs     = a_rhs.getFArrayBox();
+  const FArrayBox& aco     = Acoef.getFArrayBox();
+
+  std::array<const FArrayBox*, SpaceDim> bco;
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    bco[dir] = &(Bcoef[dir].getFArrayBox());
+  }
+
+  // Restriction of the fine-grid residual onto a single coarse cell.
+  auto coarKernel = [&](const IntVect& ivCoar) -> void {
+    Real sum = 0.0;
+    for (BoxIterator bit(refBox); bit.ok(); ++bit) {
+      sum += res(refRat * ivCoar + bit(), m_comp);
+    }
+
+    resCoar(ivCoar, 0) = weight * sum;
+  };
+
+  // Covered patches do not have an operator, so the residual is just the right-hand side.
+  if (ebisbox.isAllCovered()) {
+    a_res.setVal(0.0);
+    a_res.plus(a_rhs, cellBox, m_comp, m_comp, 1);
+
+    BoxLoops::loop(coarBox, coarKernel);
+
+    return;
+  }
+
+  // Fill a_phi such that centered differences pushes in the domain flux.
+  this->applyDomainFlux(a_phi, Bcoef, cellBox, a_dit, true);
+
+  // Fused residual + restriction kernel for the regular cells.
+  const Real factor = m_beta / (m_dx * m_dx);
+
+  auto regularKernel = [&](const IntVect& iv) -> void {
+    const Real r = rhs(iv, m_comp) - this->applyRegularStencil(iv, phi, aco, bco, factor);
+
+    res(iv, m_comp) = r;
+    resCoar(coarsen(iv, refRat), 0) += weight * r;
+  };
+
+  CH_START(t1);
+  Box tiles = coarBox;
+  tiles.coarsen(m_restrictTileSize);
+
+  for (BoxIterator bit(tiles); bit.ok(); ++bit) {
+    const IntVect tileLo = m_restrictTileSize * bit();
+
+    Box tileBox = Box(tileLo, tileLo + tileLen) & coarBox;
+    tileBox.refine(refRat);
+
+    BoxLoops::loop(tileBox, regularKernel);
+  }
+  CH_STOP(t1);
+
+  // Cells with explicit stencils. applyOpIrregular puts L(phi) in a_res, so we convert that to a residual. Then redo the restriction
+  // in the coarse cells that overlap these cells.
   CH_START(t2);
-  BoxLoops::loop(a_cellBox, kernel);
+  this->applyOpIrregular(a_res,
+                         a_phi,
+                         Acoef,
+                         Bcoef,
+                         (*m_BcoefIrreg)[a_dit],
+                         m_alphaDiagWeight[a_dit],
+                         cellBox,
+                         a_dit,
+                         true);
+
+  auto residualKernel = [&](const VolIndex& vof) -> void {
+    a_res(vof, m_comp) = a_rhs(vof, m_comp) - a_res(vof, m_comp);
+  };
+
+  auto restrictKernel = [&](const VolIndex& vof) -> void {
+    coarKernel(coarsen(vof.gridIndex(), refRat));
+  };
+
+  BoxLoops::loop(m_vofIterStenc[a_dit], residualKernel);
+  BoxLoops::loop(m_vofIterStenc[a_dit], restrictKernel);
   CH_STOP(t2);
 }
 
@@ -1629,6 +1824,16 @@ EBHelmholtzOp::relaxPointJacobi(LevelData<EBCellFAB>&       a_correction,
   const int                nbox = dit.size();
 
   for (int iter = 0; iter < a_iterations; iter++) {
+    if (m_overlapExchange && m_doExchange) {
+      auto update = [&](const DataIndex& din) -> void {
+        this->pointJacobiUpdate(Lcorr[din], a_correction[din], a_residual[din], din);
+      };
+
+      this->applyOpOverlapped(Lcorr, a_correction, nullptr, true, true, true, update);
+
+      continue;
+    }
+
     if (m_doExchange) {
       a_correction.exchange(m_exchangeCopier);
     }
@@ -1669,14 +1874,24 @@ EBHelmholtzOp::pointJacobiKernel(EBCellFAB&             a_Lcorr,
 
   if (!ebisbox.isAllCovered()) {
     this->applyOp(a_Lcorr, a_correction, a_Acoef, a_Bcoef, a_BcoefIrreg, a_cellBox, a_dit, true);
-
-    a_Lcorr -= a_residual;
-    a_Lcorr *= m_relCoef[a_dit];
-    a_Lcorr *= 0.5;
-    a_correction -= a_Lcorr;
+    this->pointJacobiUpdate(a_Lcorr, a_correction, a_residual, a_dit);
   }
 }
 
+void
+EBHelmholtzOp::pointJacobiUpdate(EBCellFAB&       a_Lcorr,
+                                 EBCellFAB&       a_corr,
+                                 const EBCellFAB& a_resid,
+                                 const DataIndex& a_dit) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::pointJacobiUpdate(EBCellFAB, EBCellFAB, EBCellFAB, DataIndex)");
+
+  a_Lcorr -= a_resid;
+  a_Lcorr *= m_relCoef[a_dit];
+  a_Lcorr *= 0.5;
+  a_corr -= a_Lcorr;
+}
+
 void
 EBHelmholtzOp::relaxGSRedBlack(LevelData<EBCellFAB>&       a_correction,
                                const LevelData<EBCellFAB>& a_residual,
@@ -1699,6 +1914,16 @@ EBHelmholtzOp::relaxGSRedBlack(LevelData<EBCellFAB>&       a_correction,
 
     // First do "red" cells, then "black" cells. Note that ghost cell interpolation and exchanges are required between the colors.
     for (int redBlack = 0; redBlack <= 1; redBlack++) {
+      if (m_overlapExchange && m_doExchange) {
+        auto update = [&](const DataIndex& din) -> void {
+          this->gauSaiRedBlackUpdate(Lcorr[din], a_correction[din], a_residual[din], dbl[din], din, redBlack);
+        };
+
+        this->applyOpOverlapped(Lcorr, a_correction, nullptr, true, true, true, update);
+
+        continue;
+      }
+
       if (m_doExchange) {
         a_correction.exchange(m_exchangeCopier);
       }
@@ -1735,54 +1960,67 @@ EBHelmholtzOp::gauSaiRedBlackKernel(EBCellFAB&             a_Lcorr,
                                     const DataIndex&       a_dit,
                                     const int&             a_redBlack) const noexcept
 {
-  CH_TIMERS("EBHelmholtzOp::gauSaiRedBlackKernel");
-  CH_TIMER("EBHelmholtzOp::regular_cells", t1);
-  CH_TIMER("EBHelmholtzOp::irregular_cells", t2);
+  CH_TIME("EBHelmholtzOp::gauSaiRedBlackKernel");
 
   // This is the kernel for computing phi^(k+1) = phi^k - (res - L(phi))/|diag(L)| with a red-black pattern. Here, "red" cells are encoded by a_redBlack=0.
 
-  const EBISBox&   ebisbox = m_eblg.getEBISL()[a_dit];
-  const EBCellFAB& relCoef = m_relCoef[a_dit];
+  const EBISBox& ebisbox = m_eblg.getEBISL()[a_dit];
 
   if (!ebisbox.isAllCovered()) {
     this->applyOp(a_Lcorr, a_corr, a_Acoef, a_Bcoef, a_BcoefIrreg, a_cellBox, a_dit, true);
+    this->gauSaiRedBlackUpdate(a_Lcorr, a_corr, a_resid, a_cellBox, a_dit, a_redBlack);
+  }
+}
 
-    BaseFab<Real>&       phiReg  = a_corr.getSingleValuedFAB();
-    const BaseFab<Real>& LphiReg = a_Lcorr.getSingleValuedFAB();
-    const BaseFab<Real>& rhsReg  = a_resid.getSingleValuedFAB();
-    const BaseFab<Real>& relReg  = relCoef.getSingleValuedFAB();
+void
+EBHelmholtzOp::gauSaiRedBlackUpdate(const EBCellFAB& a_Lcorr,
+                                    EBCellFAB&       a_corr,
+                                    const EBCellFAB& a_resid,
+                                    const Box&       a_cellBox,
+                                    const DataIndex& a_dit,
+                                    const int&       a_redBlack) const noexcept
+{
+  CH_TIMERS("EBHelmholtzOp::gauSaiRedBlackUpdate");
+  CH_TIMER("EBHelmholtzOp::regular_cells", t1);
+  CH_TIMER("EBHelmholtzOp::irregular_cells", t2);
 
-    // Regular kernel. Several ways we can do this -- we can either check if the cell is red/black like we do here, which is the easiest. This should
-    // not come at a performance cost, I think. An alternative is to compute an offset on the starting index on the innermost loop, like we used to do
-    // with Fortran.
-    auto regularKernel = [&](const IntVect& iv) -> void {
-      const bool doThisCell = std::abs((iv.sum() + a_redBlack) % 2) == 0;
+  const EBCellFAB& relCoef = m_relCoef[a_dit];
 
-      if (doThisCell) {
-        phiReg(iv, m_comp) += relReg(iv, m_comp) * (rhsReg(iv, m_comp) - LphiReg(iv, m_comp));
-      }
-    };
+  BaseFab<Real>&       phiReg  = a_corr.getSingleValuedFAB();
+  const BaseFab<Real>& LphiReg = a_Lcorr.getSingleValuedFAB();
+  const BaseFab<Real>& rhsReg  = a_resid.getSingleValuedFAB();
+  const BaseFab<Real>& relReg  = relCoef.getSingleValuedFAB();
 
-    // Irregular red-black kernel.
-    auto irregularKernel = [&](const VolIndex& vof) -> void {
-      const IntVect& iv = vof.gridIndex();
+  // Regular kernel. Several ways we can do this -- we can either check if the cell is red/black like we do here, which is the easiest. This should
+  // not come at a performance cost, I think. An alternative is to compute an offset on the starting index on the innermost loop, like we used to do
+  // with Fortran.
+  auto regularKernel = [&](const IntVect& iv) -> void {
+    const bool doThisCell = std::abs((iv.sum() + a_redBlack) % 2) == 0;
 
-      const bool doThisCell = std::abs((iv.sum() + a_redBlack) % 2) == 0;
+    if (doThisCell) {
+      phiReg(iv, m_comp) += relReg(iv, m_comp) * (rhsReg(iv, m_comp) - LphiReg(iv, m_comp));
+    }
+  };
 
-      if (doThisCell) {
-        a_corr(vof, m_comp) += relCoef(vof, m_comp) * (a_resid(vof, m_comp) - a_Lcorr(vof, m_comp));
-      }
-    };
+  // Irregular red-black kernel.
+  auto irregularKernel = [&](const VolIndex& vof) -> void {
+    const IntVect& iv = vof.gridIndex();
 
-    // Launch the kernels over their respective domains.
-    CH_START(t1);
-    BoxLoops::loop(a_cellBox, regularKernel);
-    CH_STOP(t1);
+    const bool doThisCell = std::abs((iv.sum() + a_redBlack) % 2) == 0;
 
-    CH_START(t2);
-    BoxLoops::loop(m_vofIterMulti[a_dit], irregularKernel);
-    CH_STOP(t2);
-  }
+    if (doThisCell) {
+      a_corr(vof, m_comp) += relCoef(vof, m_comp) * (a_resid(vof, m_comp) - a_Lcorr(vof, m_comp));
+    }
+  };
+
+  // Launch the kernels over their respective domains.
+  CH_START(t1);
+  BoxLoops::loop(a_cellBox, regularKernel);
+  CH_STOP(t1);
+
+  CH_START(t2);
+  BoxLoops::loop(m_vofIterMulti[a_dit], irregularKernel);
+  CH_STOP(t2);
 }
 
 void
@@ -1806,6 +2044,16 @@ EBHelmholtzOp::relaxGSMultiColor(LevelData<EBCellFAB>&       a_correction,
 
   for (int iter = 0; iter < a_iterations; iter++) {
     for (int icolor = 0; icolor < m_colors.size(); icolor++) {
+      if (m_overlapExchange && m_doExchange) {
+        auto update = [&](const DataIndex& din) -> void {
+          this->gauSaiMultiColorUpdate(Lcorr[din], a_correction[din], a_residual[din], dbl[din], din, m_colors[icolor]);
+        };
+
+        this->applyOpOverlapped(Lcorr, a_correction, nullptr, true, true, true, update);
+
+        continue;
+      }
+
       if (m_doExchange) {
         a_correction.exchange(m_exchangeCopier);
       }
@@ -1847,55 +2095,226 @@ EBHelmholtzOp::gauSaiMultiColorKernel(EBCellFAB&             a_Lcorr,
   // This is the kernel for computing phi^(k+1) = phi^k - (res - L(phi))/|diag(L)| with a "multi-colored" pattern. As with red-black, we follow a pattern, but
   // the pattern in this case uses more "colors".
 
-  const EBISBox&   ebisbox = m_eblg.getEBISL()[a_dit];
-  const EBCellFAB& relCoef = m_relCoef[a_dit];
+  const EBISBox& ebisbox = m_eblg.getEBISL()[a_dit];
 
   if (!ebisbox.isAllCovered()) {
     this->applyOp(a_Lcorr, a_corr, a_Acoef, a_Bcoef, a_BcoefIrreg, a_cellBox, a_dit, true);
+    this->gauSaiMultiColorUpdate(a_Lcorr, a_corr, a_resid, a_cellBox, a_dit, a_color);
+  }
+}
 
-    BaseFab<Real>&       phiReg  = a_corr.getSingleValuedFAB();
-    const BaseFab<Real>& LphiReg = a_Lcorr.getSingleValuedFAB();
-    const BaseFab<Real>& rhsReg  = a_resid.getSingleValuedFAB();
-    const BaseFab<Real>& relReg  = relCoef.getSingleValuedFAB();
+void
+EBHelmholtzOp::gauSaiMultiColorUpdate(const EBCellFAB& a_Lcorr,
+                                      EBCellFAB&       a_corr,
+                                      const EBCellFAB& a_resid,
+                                      const Box&       a_cellBox,
+                                      const DataIndex& a_dit,
+                                      const IntVect&   a_color) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::gauSaiMultiColorUpdate(EBCellFAB, EBCellFAB, EBCellFAB, Box, DataIndex, IntVect)");
 
-    // Regular cells (well, plus whatever is not multi-valued)
-    IntVect loIV = a_cellBox.smallEnd();
-    IntVect hiIV = a_cellBox.bigEnd();
-    for (int dir = 0; dir < SpaceDim; dir++) {
-      if (loIV[dir] % 2 != a_color[dir])
-        loIV[dir]++;
-    }
+  const EBCellFAB& relCoef = m_relCoef[a_dit];
 
-    if (loIV <= hiIV) {
-      const Box colorBox(loIV, hiIV);
+  BaseFab<Real>&       phiReg  = a_corr.getSingleValuedFAB();
+  const BaseFab<Real>& LphiReg = a_Lcorr.getSingleValuedFAB();
+  const BaseFab<Real>& rhsReg  = a_resid.getSingleValuedFAB();
+  const BaseFab<Real>& relReg  = relCoef.getSingleValuedFAB();
 
-      // Regular kernel. This is just the point Jacobi -- the magic happens in the striding below.
-      auto regularKernel = [&](const IntVect& iv) -> void {
-        phiReg(iv, m_comp) += relReg(iv, m_comp) * (rhsReg(iv, m_comp) - LphiReg(iv, m_comp));
-      };
+  // Regular cells (well, plus whatever is not multi-valued)
+  IntVect loIV = a_cellBox.smallEnd();
+  IntVect hiIV = a_cellBox.bigEnd();
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    if (loIV[dir] % 2 != a_color[dir])
+      loIV[dir]++;
+  }
 
-      // Irregular kernel Does the same as above -- a stride of two.
-      auto irregularKernel = [&](const VolIndex& vof) -> void {
-        const IntVect& iv = vof.gridIndex();
+  if (loIV <= hiIV) {
+    const Box colorBox(loIV, hiIV);
 
-        // Do stride check.
-        bool doThisCell = true;
-        for (int dir = 0; dir < SpaceDim; dir++) {
-          if (iv[dir] % 2 != a_color[dir]) {
-            doThisCell = false;
-          }
-        }
+    // Regular kernel. This is just the point Jacobi -- the magic happens in the striding below.
+    auto regularKernel = [&](const IntVect& iv) -> void {
+      phiReg(iv, m_comp) += relReg(iv, m_comp) * (rhsReg(iv, m_comp) - LphiReg(iv, m_comp));
+    };
+
+    // Irregular kernel Does the same as above -- a stride of two.
+    auto irregularKernel = [&](const VolIndex& vof) -> void {
+      const IntVect& iv = vof.gridIndex();
 
-        if (doThisCell) {
-          a_corr(vof, m_comp) += relCoef(vof, m_comp) * (a_resid(vof, m_comp) - a_Lcorr(vof, m_comp));
+      // Do stride check.
+      bool doThisCell = true;
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        if (iv[dir] % 2 != a_color[dir]) {
+          doThisCell = false;
         }
-      };
+      }
+
+      if (doThisCell) {
+        a_corr(vof, m_comp) += relCoef(vof, m_comp) * (a_resid(vof, m_comp) - a_Lcorr(vof, m_comp));
+      }
+    };
+
+    // Launch the kernels.
+    BoxLoops::loop(colorBox, regularKernel, 2 * IntVect::Unit);
+    BoxLoops::loop(m_vofIterMulti[a_dit], irregularKernel);
+  }
+}
+
+void
+EBHelmholtzOp::applyOpOverlapped(LevelData<EBCellFAB>&                        a_Lphi,
+                                 LevelData<EBCellFAB>&                        a_phi,
+                                 const LevelData<EBCellFAB>* const            a_phiCoar,
+                                 const bool                                   a_homogeneousPhysBC,
+                                 const bool                                   a_homogeneousCFBC,
+                                 const bool                                   a_interpCF,
+                                 const std::function<void(const DataIndex&)>& a_patchUpdate)
+{
+  CH_TIMERS("EBHelmholtzOp::applyOpOverlapped");
+  CH_TIMER("EBHelmholtzOp::applyOpOverlapped::exchange_begin", t1);
+  CH_TIMER("EBHelmholtzOp::applyOpOverlapped::interior", t2);
+  CH_TIMER("EBHelmholtzOp::applyOpOverlapped::exchange_end", t3);
+  CH_TIMER("EBHelmholtzOp::applyOpOverlapped::boundary", t4);
+
+  // TLDR: The regular stencil in the interior cells of each patch does not reach into ghost cells, so we can compute L(phi) there while
+  //       the exchange is in progress. Once the exchange has completed we interpolate the ghost cells across the refinement boundaries
+  //       and then complete L(phi) near the patch boundaries and in the cut-cells. Since the exchange only modifies ghost cells this gives the
+  //       same result as the blocking version. Any patch updates (e.g. relaxation kernels) are done after L(phi) is complete in a patch.
+
+  const DisjointBoxLayout& dbl   = m_eblg.getDBL();
+  const EBISLayout&        ebisl = m_eblg.getEBISL();
+  const DataIterator&      dit   = dbl.dataIterator();
+
+  const int nbox = dit.size();
+
+  // Begin the exchange.
+  if (m_profile) {
+    m_timer.startEvent("Exchange begin");
+  }
+  CH_START(t1);
+  a_phi.exchangeBegin(m_exchangeCopier);
+  CH_STOP(t1);
+  if (m_profile) {
+    m_timer.stopEvent("Exchange begin");
+    m_timer.startEvent("Interior");
+  }
+
+  // Compute L(phi) in the interior of each patch.
+  CH_START(t2);
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
 
-      // Launch the kernels.
-      BoxLoops::loop(colorBox, regularKernel, 2 * IntVect::Unit);
-      BoxLoops::loop(m_vofIterMulti[a_dit], irregularKernel);
+    if (!(ebisl[din].isAllCovered())) {
+      this->applyOpRegularKernel(a_Lphi[din], a_phi[din], (*m_Acoef)[din], (*m_Bcoef)[din], m_interiorBoxes[din]);
     }
   }
+  CH_STOP(t2);
+
+  // Finish the exchange and fill ghost cells on the refinement boundaries.
+  if (m_profile) {
+    m_timer.stopEvent("Interior");
+    m_timer.startEvent("Exchange end");
+  }
+  CH_START(t3);
+  a_phi.exchangeEnd();
+
+  if (m_hasCoar && a_interpCF) {
+    this->interpolateCF(a_phi, a_phiCoar, a_homogeneousCFBC);
+  }
+  CH_STOP(t3);
+  if (m_profile) {
+    m_timer.stopEvent("Exchange end");
+    m_timer.startEvent("Boundary");
+  }
+
+  // Complete L(phi) in the boundary shell and in the cut-cells, and then do the patch update.
+  CH_START(t4);
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    if (!(ebisl[din].isAllCovered())) {
+      EBCellFAB& Lphi = a_Lphi[din];
+      EBCellFAB& phi  = a_phi[din];
+
+      const Box              cellBox    = dbl[din];
+      const EBCellFAB&       Acoef      = (*m_Acoef)[din];
+      const EBFluxFAB&       Bcoef      = (*m_Bcoef)[din];
+      const BaseIVFAB<Real>& BcoefIrreg = (*m_BcoefIrreg)[din];
+
+      this->applyDomainFlux(phi, Bcoef, cellBox, din, a_homogeneousPhysBC);
+
+      for (const auto& shellBox : m_shellBoxes[din]) {
+        this->applyOpRegularKernel(Lphi, phi, Acoef, Bcoef, shellBox);
+      }
+
+      this->applyOpIrregular(Lphi,
+                             phi,
+                             Acoef,
+                             Bcoef,
+                             BcoefIrreg,
+                             m_alphaDiagWeight[din],
+                             cellBox,
+                             din,
+                             a_homogeneousPhysBC);
+
+      if (a_patchUpdate) {
+        a_patchUpdate(din);
+      }
+    }
+  }
+  CH_STOP(t4);
+  if (m_profile) {
+    m_timer.stopEvent("Boundary");
+  }
+}
+
+void
+EBHelmholtzOp::defineOverlapRegions() noexcept
+{
+  CH_TIME("EBHelmholtzOp::defineOverlapRegions");
+
+  // TLDR: The regular 5/7 point stencil only reaches one cell outwards, so L(phi) can be computed in grow(cellBox, -1) without valid ghost
+  //       cells. The remaining cells in the patch are stored as disjoint slabs along each coordinate direction.
+
+  const DisjointBoxLayout& dbl = m_eblg.getDBL();
+  const DataIterator&      dit = dbl.dataIterator();
+
+  m_interiorBoxes.define(dbl);
+  m_shellBoxes.define(dbl);
+
+  const int nbox = dit.size();
+
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    Box               interior = dbl[din];
+    std::vector<Box>& shell    = m_shellBoxes[din];
+
+    shell.resize(0);
+
+    for (int dir = 0; dir < SpaceDim && !(interior.isEmpty()); dir++) {
+      if (interior.size(dir) <= 2) {
+        shell.emplace_back(interior);
+
+        interior = Box();
+      }
+      else {
+        Box lo = interior;
+        Box hi = interior;
+
+        lo.setBig(dir, interior.smallEnd(dir));
+        hi.setSmall(dir, interior.bigEnd(dir));
+
+        shell.emplace_back(lo);
+        shell.emplace_back(hi);
+
+        interior.grow(dir, -1);
+      }
+    }
+
+    m_interiorBoxes[din] = interior;
+  }
 }
 
 void
@@ -2222,27 +2641,40 @@ EBHelmholtzOp::computeFaceCentroidFlux(EBFaceFAB&       a_flux,
   // This routine computes the face centroid fluxes using precomputed stencils (in defineStencils). This is needed because
   // cut-cell faces require more than centered differencing.
 
-  const BaseIFFAB<VoFStencil>& fluxStencils = m_centroidFluxStencil[a_dir][a_dit];
-  const EBGraph&               ebgraph      = fluxStencils.getEBGraph();
-  IntVectSet                   ivs          = fluxStencils.getIVS();
+  const CompiledStencil&        fluxStencils = m_centroidFluxCompiled[a_dir][a_dit];
+  const std::vector<FaceIndex>& fluxFaces    = m_centroidFluxFaces[a_dir][a_dit];
+
+  // The stencils are compiled for all faces in the patch.
+  if (a_cellBox == m_eblg.getDBL()[a_dit]) {
+    auto kernel = [&](const int row, const Real value) -> void {
+      a_flux(fluxFaces[row], m_comp) = value;
+    };
+
+    fluxStencils.gather(a_phi, m_comp, kernel);
+  }
+  else {
+    const BaseIFFAB<VoFStencil>& stencils = m_centroidFluxStencil[a_dir][a_dit];
+    const EBGraph&               ebgraph  = stencils.getEBGraph();
+    IntVectSet                   ivs      = stencils.getIVS();
 
-  ivs &= a_cellBox;
+    ivs &= a_cellBox;
 
-  FaceIterator faceIt(ivs, ebgraph, a_dir, FaceStop::SurroundingNoBoundary);
+    FaceIterator faceIt(ivs, ebgraph, a_dir, FaceStop::SurroundingNoBoundary);
 
-  auto kernel = [&](const FaceIndex& face) -> void {
-    const VoFStencil& sten = fluxStencils(face, m_comp);
+    auto kernel = [&](const FaceIndex& face) -> void {
+      const VoFStencil& sten = stencils(face, m_comp);
 
-    a_flux(face, m_comp) = 0.0;
-    for (int i = 0; i < sten.size(); i++) {
-      const VolIndex& ivof    = sten.vof(i);
-      const Real&     iweight = sten.weight(i);
+      a_flux(face, m_comp) = 0.0;
+      for (int i = 0; i < sten.size(); i++) {
+        const VolIndex& ivof    = sten.vof(i);
+        const Real&     iweight = sten.weight(i);
 
-      a_flux(face, m_comp) += iweight * a_phi(ivof, m_comp);
-    }
-  };
+        a_flux(face, m_comp) += iweight * a_phi(ivof, m_comp);
+      }
+    };
 
-  BoxLoops::loop(faceIt, kernel);
+    BoxLoops::loop(faceIt, kernel);
+  }
 }
 
 void
@@ -20,6 +20,7 @@
 
 // Our includes
 #include <CD_EBHelmholtzOpFactory.H>
+#include <CD_LoadBalancing.H>
 #include <CD_NamespaceHeader.H>
 
 EBHelmholtzOpFactory::EBHelmholtzOpFactory(const Location::Cell    a_dataLocation,
@@ -42,6 +43,7 @@ EBHelmholtzOpFactory::EBHelmholtzOpFactory(const Location::Cell    a_dataLocatio
                                            const Smoother&         a_smoother,
                                            const ProblemDomain&    a_bottomDomain,
                                            const int&              a_mgBlockingFactor,
+                                           const int&              a_agglomeration,
                                            const AmrLevelGrids&    a_deeperLevelGrids)
 {
   CH_TIME("EBHelmholtzOpFactory::EBHelmholtzOpFactory(...)");
@@ -73,6 +75,7 @@ EBHelmholtzOpFactory::EBHelmholtzOpFactory(const Location::Cell    a_dataLocatio
   m_smoother         = a_smoother;
   m_bottomDomain     = a_bottomDomain;
   m_mgBlockingFactor = a_mgBlockingFactor;
+  m_agglomeration    = a_agglomeration;
   m_deeperLevelGrids = a_deeperLevelGrids;
 
   m_numAmrLevels = m_amrLevelGrids.size();
@@ -161,8 +164,10 @@ EBHelmholtzOpFactory::defineMultigridLevels()
           mgEblgCoar = m_deeperLevelGrids[curMgLevels - 1]; // coarsest AMR level. So curMgLevels-1 is correct.
         }
         else {
-          // Let the operator factory do the coarsening this time.
-          hasCoarser = this->getCoarserLayout(*mgEblgCoar, mgEblgFine, mgRefRatio, m_mgBlockingFactor);
+          // Let the operator factory do the coarsening this time. Levels below the coarsest AMR level can be agglomerated onto fewer ranks.
+          const int agglomeration = (amrLevel == 0) ? m_agglomeration : 0;
+
+          hasCoarser = this->getCoarserLayout(*mgEblgCoar, mgEblgFine, mgRefRatio, m_mgBlockingFactor, agglomeration);
         }
 
         // Do not coarsen further if we end up with a domain smaller than m_bottomDomain. In this case
@@ -349,9 +354,10 @@ bool
 EBHelmholtzOpFactory::getCoarserLayout(EBLevelGrid&       a_coarEblg,
                                        const EBLevelGrid& a_fineEblg,
                                        const int          a_refRat,
-                                       const int          a_blockingFactor) const
+                                       const int          a_blockingFactor,
+                                       const int          a_agglomeration) const
 {
-  CH_TIME("EBHelmholtzOpFactory::getCoarserLayout(EBLevelGrid, EBLevelGrid, int, int)");
+  CH_TIME("EBHelmholtzOpFactory::getCoarserLayout(EBLevelGrid, EBLevelGrid, int, int, int)");
 
   bool hasCoarser = false;
 
@@ -387,7 +393,14 @@ EBHelmholtzOpFactory::getCoarserLayout(EBLevelGrid&       a_coarEblg,
 
           domainSplit(coarDomain, boxes, a_blockingFactor);
           mortonOrdering(boxes);
-          LoadBalance(procs, boxes);
+
+          // Coarse levels may have far fewer boxes than ranks. If asked to, gather them on a few ranks rather than spreading them out.
+          if (a_agglomeration > 0) {
+            LoadBalancing::agglomerate(procs, boxes, a_agglomeration);
+          }
+          else {
+            LoadBalance(procs, boxes);
+          }
 
           coarDbl.define(boxes, procs, coarDomain);
 
@@ -21,6 +21,7 @@
 #include <CD_MultifluidAlias.H>
 #include <CD_DataOps.H>
 #include <CD_MFBaseIVFAB.H>
+#include <CD_LoadBalancing.H>
 #include <CD_NamespaceHeader.H>
 
 constexpr int MFHelmholtzOpFactory::m_comp;
@@ -51,6 +52,7 @@ MFHelmholtzOpFactory::MFHelmholtzOpFactory(const MFIS&             a_mfis,
                                            const int&              a_jumpOrder,
                                            const int&              a_jumpWeight,
                                            const int&              a_blockingFactor,
+                                           const int&              a_agglomeration,
                                            const AmrLevelGrids&    a_deeperLevelGrids)
 {
   CH_TIME("MFHelmholtzOpFactory::MFHelmholtzOpFactory()");
@@ -87,6 +89,7 @@ MFHelmholtzOpFactory::MFHelmholtzOpFactory(const MFIS&             a_mfis,
   m_jumpWeight = a_jumpWeight;
 
   m_mgBlockingFactor = a_blockingFactor;
+  m_agglomeration    = a_agglomeration;
 
   m_deeperLevelGrids = a_deeperLevelGrids;
 
@@ -293,8 +296,10 @@ MFHelmholtzOpFactory::defineMultigridLevels()
           mgMflgCoar = m_deeperLevelGrids[curMgLevels - 1]; // coarsest AMR level. So curMgLevels-1 is correct.
         }
         else {
-          // Let the operator factory do the coarsening this time.
-          hasCoarser = this->getCoarserLayout(mgMflgCoar, mgMflgFine, mgRefRatio, m_mgBlockingFactor);
+          // Let the operator factory do the coarsening this time. Levels below the coarsest AMR level can be agglomerated onto fewer ranks.
+          const int agglomeration = (amrLevel == 0) ? m_agglomeration : 0;
+
+          hasCoarser = this->getCoarserLayout(mgMflgCoar, mgMflgFine, mgRefRatio, m_mgBlockingFactor, agglomeration);
         }
 
         // Do not coarsen further if we end up with a domain smaller than m_bottomDomain. In this case
@@ -490,9 +495,10 @@ bool
 MFHelmholtzOpFactory::getCoarserLayout(MFLevelGrid&       a_coarMflg,
                                        const MFLevelGrid& a_fineMflg,
                                        const int          a_refRat,
-                                       const int          a_blockingFactor) const
+                                       const int          a_blockingFactor,
+                                       const int          a_agglomeration) const
 {
-  CH_TIME("MFHelmholtzOpFactory::getCoarserLayout(MFLevelGrid, MFLevelGrid, int, int)");
+  CH_TIME("MFHelmholtzOpFactory::getCoarserLayout(MFLevelGrid, MFLevelGrid, int, int, int)");
 
   CH_assert(a_blockingFactor % 2 == 0);
   CH_assert(a_blockingFactor >= 2);
@@ -531,7 +537,14 @@ MFHelmholtzOpFactory::getCoarserLayout(MFLevelGrid&       a_coarMflg,
 
           domainSplit(coarDomain, boxes, block);
           mortonOrdering(boxes);
-          LoadBalance(procs, boxes);
+
+          // Coarse levels may have far fewer boxes than ranks. If asked to, gather them on a few ranks rather than spreading them out.
+          if (a_agglomeration > 0) {
+            LoadBalancing::agglomerate(procs, boxes, a_agglomeration);
+          }
+          else {
+            LoadBalance(procs, boxes);
+          }
 
           coarDbl.define(boxes, procs, coarDomain);
 
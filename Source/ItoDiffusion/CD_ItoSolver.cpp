@@ -1025,11 +1025,9 @@ ItoSolver::writeCheckPointLevelFluid(HDF5Handle& a_handle, const int a_level) co
   const std::string str = m_name + "_particlesF";
 
   // Handles to relevant grid information
-  const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[a_level];
-  const DataIterator&      dit    = dbl.dataIterator();
-  const EBISLayout&        ebisl  = m_amr->getEBISLayout(m_realm, m_phase)[a_level];
-  const RealVect           dx     = m_amr->getDx()[a_level] * RealVect::Unit;
-  const RealVect           probLo = m_amr->getProbLo();
+  const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[a_level];
+  const DataIterator&      dit   = dbl.dataIterator();
+  const EBISLayout&        ebisl = m_amr->getEBISLayout(m_realm, m_phase)[a_level];
 
   // Handle to the particles that will be checkpointed.
   const ParticleContainer<ItoParticle>& particles = m_particleContainers.at(WhichContainer::Bulk);
@@ -1050,20 +1048,16 @@ ItoSolver::writeCheckPointLevelFluid(HDF5Handle& a_handle, const int a_level) co
     // For multi-valued cells all the particles go onto the first vof.
     BaseFab<Real>& particleNumbersFAB = particleNumbers[din].getSingleValuedFAB();
 
-    // Add the patch particles into cell-sorted particles.
-    BinFab<ItoParticle> cellSortedParticles(cellBox, dx, probLo);
-    cellSortedParticles.addItems(particles[a_level][din].listItems());
+    // Cell-sorted view of the patch particles.
+    ParticleCellBins<ItoParticle> cellSortedParticles;
+    particles.getCellParticles(cellSortedParticles, a_level, din);
 
     // Kernel - go through the patch and get the number of particles per cell.
     auto kernel = [&](const IntVect& iv) -> void {
-      const List<ItoParticle>& cellParticles = cellSortedParticles(iv, m_comp);
-
       // Go through the particles in the current grid cell and set the number of particles.
       particleNumbersFAB(iv, m_comp) = 0.0;
-      for (ListIterator<ItoParticle> lit(cellParticles); lit.ok(); ++lit) {
-        const ItoParticle& p = lit();
-
-        particleNumbersFAB(iv, m_comp) += p.weight();
+      for (const ItoParticle* p : cellSortedParticles(iv)) {
+        particleNumbersFAB(iv, m_comp) += p->weight();
       }
     };
 
@@ -3113,14 +3107,17 @@ ItoSolver::makeSuperparticlesEqualWeightKD(List<ItoParticle>& a_particles,
   CH_TIMER("ItoSolver::makeSuperparticlesEqualWeightKD::build_kd", t2);
   CH_TIMER("ItoSolver::makeSuperparticlesEqualWeightKD::merge_particles", t3);
 
-  using PType        = NonCommParticle<2, 1>;
-  using Node         = KDNode<PType>;
-  using ParticleList = KDNode<PType>::ParticleList;
+  using PType = NonCommParticle<2, 1>;
+
+  // The KD-tree is built in a thread-local arena so that we don't allocate memory for every cell we merge particles in.
+  static thread_local KDArena<PType> arena;
 
   // 1. Make the input list into a vector of particles with a smaller memory footprint.
   CH_START(t1);
-  Real         W = 0.0;
-  ParticleList particles;
+  arena.clear();
+
+  KDArena<PType>::ParticleList& particles = arena.getParticles();
+
   for (ListIterator<ItoParticle> lit(a_particles); lit.ok(); ++lit) {
     PType p;
 
@@ -3128,8 +3125,6 @@ ItoSolver::makeSuperparticlesEqualWeightKD(List<ItoParticle>& a_particles,
     p.template real<1>() = lit().energy();
     p.template vect<0>() = lit().position();
 
-    W += lit().weight();
-
     particles.emplace_back(p);
   }
   CH_STOP(t1);
@@ -3141,22 +3136,27 @@ ItoSolver::makeSuperparticlesEqualWeightKD(List<ItoParticle>& a_particles,
   };
 
   // 2. Build KD-tree.
-  const std::vector<std::shared_ptr<Node>> leaves = ParticleManagement::
-    recursivePartitionAndSplitEqualWeightKD<PType, &PType::template real<0>, &PType::template vect<0>>(
-      particles,
-      a_ppc,
-      particleReconcile);
+  CH_START(t2);
+  ParticleManagement::recursivePartitionAndSplitEqualWeightKD<PType, &PType::template real<0>, &PType::template vect<0>>(
+    arena,
+    a_ppc,
+    particleReconcile);
+  CH_STOP(t2);
 
   // Merge leaves into new particles.
   CH_START(t3);
   a_particles.clear();
 
-  for (const auto& l : leaves) {
+  const KDArena<PType>::ParticleList& leafParticles = arena.getParticles();
+
+  for (const auto& l : arena.getLeaves()) {
     Real     w = 0.0;
     Real     e = 0.0;
     RealVect x = RealVect::Zero;
 
-    for (const auto& p : l->getParticles()) {
+    for (size_t i = l.m_begin; i < l.m_end; i++) {
+      const PType& p = leafParticles[i];
+
       w += p.template real<0>();
       x += p.template real<0>() * p.template vect<0>();
       e += p.template real<0>() * p.template real<1>();
@@ -49,6 +49,7 @@ EddingtonSP1::EddingtonSP1() : RtSolver()
   m_isSolverSetup = false;
   m_dataLocation  = Location::Cell::Center;
   m_regridSlopes  = true;
+  m_eulerDt       = -1.0;
 
   // This fills m_domainBcFunctions with s_defaultDomainBcFunction on every domain side.
   this->setDefaultDomainBcFunctions();
@@ -74,6 +75,7 @@ EddingtonSP1::parseOptions()
   this->parseMultigridSettings(); // Parses solver parameters for geometric multigrid
   this->parseKappaScale();        // Parses kappa-scaling
   this->parseRegridSlopes();      // Slopes on/off when regridding
+  this->parseInitialGuess();      // Solution history and cycle reporting
 }
 
 void
@@ -89,6 +91,7 @@ EddingtonSP1::parseRuntimeOptions()
   this->parseMultigridSettings(); // Parses solver parameters for geometric multigrid
   this->parseKappaScale();        // Parses kappa-scaling
   this->parseRegridSlopes();      // Slopes on/off when regridding
+  this->parseInitialGuess();      // Solution history and cycle reporting
 }
 
 void
@@ -385,9 +388,12 @@ EddingtonSP1::parseMultigridSettings()
     else if (str == "gmres") {
       m_bottomSolverType = BottomSolverType::GMRES;
     }
+    else if (str == "direct") {
+      m_bottomSolverType = BottomSolverType::Direct;
+    }
     else {
       MayDay::Error(
-        "EddingtonSP1::parseMultigridSettings - logic bust, you've specified one parameter and I expected either 'bicgstab' or 'gmres'");
+        "EddingtonSP1::parseMultigridSettings - logic bust, you've specified one parameter and I expected 'bicgstab', 'gmres', or 'direct'");
     }
   }
   else if (num == 2) {
@@ -405,7 +411,7 @@ EddingtonSP1::parseMultigridSettings()
   }
   else {
     MayDay::Error(
-      "EddingtonSP1::parseMultigridSettings - logic bust in bottom solver. You must specify ' = bicgstab', ' = gmres', or ' = simple <number>'");
+      "EddingtonSP1::parseMultigridSettings - logic bust in bottom solver. You must specify ' = bicgstab', ' = gmres', ' = direct', or ' = simple <number>'");
   }
 
   // Relaxation type
@@ -432,6 +438,11 @@ EddingtonSP1::parseMultigridSettings()
     MayDay::Error("EddingtonSP1::parseMultigridSettings - unknown cycle type requested");
   }
 
+  // Agglomeration of the multigrid levels below the coarsest AMR level onto fewer ranks. Defaults to no agglomeration.
+  m_multigridAgglomeration = 0;
+
+  pp.query("gmg_agglomerate", m_multigridAgglomeration);
+
   // No lower than 2.
   if (m_minCellsBottom < 2) {
     m_minCellsBottom = 2;
@@ -547,6 +558,13 @@ EddingtonSP1::regrid(const int a_lmin, const int a_oldFinestLevel, const int a_n
   m_amr->conservativeAverage(m_phi, m_realm, m_phase);
   m_amr->interpGhost(m_phi, m_realm, m_phase);
 
+  // The stored solutions still live on the old grids, so they are regridded in the same way as phi.
+  m_solutionHistory.remap([&](EBAMRCellData& a_newData, const EBAMRCellData& a_oldData) -> void {
+    m_amr->allocate(a_newData, m_realm, m_phase, m_nComp);
+    m_amr->interpToNewGrids(a_newData, a_oldData, m_phase, a_lmin, a_oldFinestLevel, a_newFinestLevel, interpType);
+    m_amr->conservativeAverage(a_newData, m_realm, m_phase);
+  });
+
   m_isSolverSetup = false;
 
   // Deallocate the scratch data.
@@ -609,8 +627,16 @@ EddingtonSP1::advance(const Real a_dt, EBAMRCellData& a_phi, const EBAMRCellData
   DataOps::copy(scaledSource, a_source); // Copy source term
   DataOps::scale(scaledSource, 1. / Units::c);
 
+  m_countingBottomSolver->resetCount();
+
   if (m_stationary) {
 
+    // Start from an extrapolation of the previous solutions if we have them.
+    if (this->extrapolateInitialGuess(a_phi, a_zeroPhi)) {
+      m_amr->conservativeAverage(a_phi, m_realm, m_phase);
+      m_amr->interpGhost(a_phi, m_realm, m_phase);
+    }
+
     // If we're doing a stationary solve, we must scale the source term by kappa (unless it's otherwise been done).
     if (m_kappaScale) {
       DataOps::kappaScale(scaledSource);
@@ -666,6 +692,14 @@ EddingtonSP1::advance(const Real a_dt, EBAMRCellData& a_phi, const EBAMRCellData
   m_amr->conservativeAverage(a_phi, m_realm, m_phase);
   m_amr->interpGhost(a_phi, m_realm, m_phase);
 
+  m_numCycles = m_countingBottomSolver->getCount();
+
+  if (m_reportCycles) {
+    pout() << m_name + "::advance - step = " << m_timeStep << ", cycles = " << m_numCycles << endl;
+  }
+
+  this->storeSolution(a_phi);
+
   return converged;
 }
 
@@ -712,6 +746,13 @@ EddingtonSP1::advanceEuler(EBAMRCellData&       a_phi,
     helmholtzOperator->setAlphaAndBeta(1.0, -a_dt);
   }
 
+  // The direct bottom solver keeps its factorization until told otherwise, so only refactorize when the time step changes.
+  if (a_dt != m_eulerDt) {
+    m_directSolver.invalidate();
+
+    m_eulerDt = a_dt;
+  }
+
   DataOps::incr(scratch, a_source, a_dt);
   if (m_kappaScale) {
     DataOps::kappaScale(scratch);
@@ -721,6 +762,12 @@ EddingtonSP1::advanceEuler(EBAMRCellData&       a_phi,
   Vector<LevelData<EBCellFAB>*> eulerRHS;
   Vector<LevelData<EBCellFAB>*> zer;
 
+  // The old solution is now in the right-hand side, so we can start from an extrapolation of the previous solutions.
+  if (this->extrapolateInitialGuess(a_phi, a_zeroPhi)) {
+    m_amr->conservativeAverage(a_phi, m_realm, m_phase);
+    m_amr->interpGhost(a_phi, m_realm, m_phase);
+  }
+
   m_amr->alias(newPhi, a_phi);
   m_amr->alias(eulerRHS, scratch);
   m_amr->alias(zer, zero);
@@ -777,6 +824,8 @@ EddingtonSP1::setHelmholtzCoefficients()
       this->setHelmholtzCoefficientsBox(helmAco[din], helmBco[din], helmBcoIrreg[din], lvl, din);
     }
   }
+
+  m_directSolver.invalidate();
 }
 
 void
@@ -966,7 +1015,8 @@ EddingtonSP1::setupHelmholtzFactory()
                                                                                       ghostRhs,
                                                                                       m_multigridRelaxMethod,
                                                                                       bottomDomain,
-                                                                                      m_amr->getMaxBoxSize()));
+                                                                                      m_amr->getMaxBoxSize(),
+                                                                                      m_multigridAgglomeration));
 }
 
 void
@@ -989,6 +1039,10 @@ EddingtonSP1::setupMultigrid()
     botsolver           = &m_gmres;
     m_gmres.m_verbosity = 0; // Shut up.
   }
+  else if (m_bottomSolverType == BottomSolverType::Direct) {
+    botsolver = &m_directSolver;
+    m_directSolver.setVerbose(m_verbosity > 5);
+  }
 
   // Make m_multigridType into an int for multigrid
   int gmgType;
@@ -1009,7 +1063,10 @@ EddingtonSP1::setupMultigrid()
   // Define AMRMultiGrid
   m_multigridSolver = RefCountedPtr<AMRMultiGrid<LevelData<EBCellFAB>>>(new AMRMultiGrid<LevelData<EBCellFAB>>());
 
-  m_multigridSolver->define(coarsestDomain, *m_helmholtzOpFactory, botsolver, 1 + finestLevel);
+  m_countingBottomSolver = RefCountedPtr<CountingLinearSolver<LevelData<EBCellFAB>>>(
+    new CountingLinearSolver<LevelData<EBCellFAB>>(botsolver));
+
+  m_multigridSolver->define(coarsestDomain, *m_helmholtzOpFactory, &(*m_countingBottomSolver), 1 + finestLevel);
   m_multigridSolver->setSolverParameters(m_multigridPreSmooth,
                                          m_multigridPostSmooth,
                                          m_multigridBottomSmooth,
@@ -13,10 +13,13 @@
 // Std includes
 #include <time.h>
 #include <chrono>
+#include <array>
+#include <cmath>
 
 // Chombo includes
 #include <ParmParse.H>
 #include <ParticleIO.H>
+#include <CH_HDF5.H>
 
 // Our includes
 #include <CD_ParticleManagement.H>
@@ -36,8 +39,10 @@ McPhoto::McPhoto()
   m_name      = "McPhoto";
   m_className = "McPhoto";
 
-  m_stationary    = false;
-  m_dirtySampling = false;
+  m_stationary     = false;
+  m_dirtySampling  = false;
+  m_streamTimeStep = -1;
+  m_streamPass     = 0;
 }
 
 McPhoto::~McPhoto()
@@ -63,13 +68,18 @@ McPhoto::advance(const Real a_dt, EBAMRCellData& a_phi, const EBAMRCellData& a_s
 
   DataOps::setValue(a_phi, 0.0);
 
-  EBAMRCellData phi;
-  EBAMRCellData numPhysPhotonsTotal;
-  EBAMRCellData numPhysPhotonsPacket;
+  // Scratch data is leased from AmrMesh so we don't reallocate these every time step.
+  EBAMRCellLease phiLease;
+  EBAMRCellLease numPhysPhotonsTotalLease;
+  EBAMRCellLease numPhysPhotonsPacketLease;
+
+  m_amr->leaseScratch(phiLease, m_realm, m_phase, 1);
+  m_amr->leaseScratch(numPhysPhotonsTotalLease, m_realm, m_phase, 1);
+  m_amr->leaseScratch(numPhysPhotonsPacketLease, m_realm, m_phase, m_numSamplingPackets);
 
-  m_amr->allocate(phi, m_realm, m_phase, 1);
-  m_amr->allocate(numPhysPhotonsTotal, m_realm, m_phase, 1);
-  m_amr->allocate(numPhysPhotonsPacket, m_realm, m_phase, m_numSamplingPackets);
+  EBAMRCellData& phi                  = *phiLease;
+  EBAMRCellData& numPhysPhotonsTotal  = *numPhysPhotonsTotalLease;
+  EBAMRCellData& numPhysPhotonsPacket = *numPhysPhotonsPacketLease;
 
   // Recall: m_photons are 'traveling' photons, m_sourcePhotons are photons to be transferred into m_photons before transport over dt,
   //         and m_ebPhotons and m_domainPhotons are photons that strike the EB or domain boundaries.
@@ -103,7 +113,24 @@ McPhoto::advance(const Real a_dt, EBAMRCellData& a_phi, const EBAMRCellData& a_s
         const EBAMRCellData& numPhysPhotons = m_amr->slice(numPhysPhotonsPacket, Interval(i, i));
 
         this->generateComputationalPhotons(m_photons, numPhysPhotons, maxPhotonsPerCell);
-        this->advancePhotonsInstantaneous(scratchPhotons, m_ebPhotons, m_domainPhotons, m_photons);
+
+        switch (m_estimator) {
+        case Estimator::Analog: {
+          this->advancePhotonsInstantaneous(scratchPhotons, m_ebPhotons, m_domainPhotons, m_photons);
+
+          break;
+        }
+        case Estimator::TrackLength: {
+          this->advancePhotonsTrackLength(scratchPhotons, m_ebPhotons, m_domainPhotons, m_photons);
+
+          break;
+        }
+        default: {
+          MayDay::Error("McPhoto::advance -- logic bust in estimator");
+
+          break;
+        }
+        }
 
         // Absorb the bulk photons on the mesh.
         this->depositPhotons<Photon, &Photon::weight>(phi, scratchPhotons, m_deposition);
@@ -167,6 +194,7 @@ McPhoto::parseOptions()
   this->parseSourceType();
   this->parseDeposition();
   this->parseIntersectionEB();
+  this->parseEstimator();
   this->parsePlotVariables();
   this->parseInstantaneous();
   this->parseDivergenceComputation();
@@ -188,6 +216,7 @@ McPhoto::parseRuntimeOptions()
   this->parseSourceType();
   this->parseDeposition();
   this->parseIntersectionEB();
+  this->parseEstimator();
   this->parsePlotVariables();
   this->parseInstantaneous();
   this->parseDivergenceComputation();
@@ -341,8 +370,11 @@ McPhoto::parseIntersectionEB()
 
   std::string str;
 
+  m_patchTestEB = false;
+
   pp.get("intersection_alg", str);
   pp.get("bisect_step", m_bisectStep);
+  pp.query("patch_eb_test", m_patchTestEB);
 
   if (str == "raycast") {
     m_intersectionEB = IntersectionEB::Raycast;
@@ -355,6 +387,43 @@ McPhoto::parseIntersectionEB()
   }
 }
 
+void
+McPhoto::parseEstimator()
+{
+  CH_TIME("McPhoto::parseEstimator");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::parseEstimator" << endl;
+  }
+
+  ParmParse pp(m_className.c_str());
+
+  std::string str = "analog";
+
+  m_trackLengthSegments  = 8;
+  m_trackLengthTolerance = 1.E-6;
+
+  pp.query("estimator", str);
+  pp.query("track_segments", m_trackLengthSegments);
+  pp.query("track_tolerance", m_trackLengthTolerance);
+
+  if (str == "analog") {
+    m_estimator = Estimator::Analog;
+  }
+  else if (str == "track_length") {
+    m_estimator = Estimator::TrackLength;
+  }
+  else {
+    MayDay::Error("McPhoto::parseEstimator -- expected 'analog' or 'track_length'");
+  }
+
+  if (m_trackLengthSegments < 1) {
+    MayDay::Error("McPhoto::parseEstimator -- 'track_segments' must be >= 1");
+  }
+  if (m_trackLengthTolerance <= 0.0 || m_trackLengthTolerance >= 1.0) {
+    MayDay::Error("McPhoto::parseEstimator -- 'track_tolerance' must be in the interval (0,1)");
+  }
+}
+
 void
 McPhoto::parseDeposition()
 {
@@ -782,6 +851,16 @@ McPhoto::writeCheckpointLevel(HDF5Handle& a_handle, const int a_level) const
   // Write particles. Must be implemented.
   std::string str = m_name + "_particles";
   writeParticlesToHDF(a_handle, m_photons[a_level], str);
+
+  // Write the random number stream counters so that a restarted simulation continues with the same streams.
+  if (a_level == 0) {
+    HDF5HeaderData header;
+
+    header.m_int[m_name + "_stream_step"] = m_streamTimeStep;
+    header.m_int[m_name + "_stream_pass"] = m_streamPass;
+
+    header.writeToFile(a_handle);
+  }
 }
 #endif
 
@@ -800,6 +879,17 @@ McPhoto::readCheckpointLevel(HDF5Handle& a_handle, const int a_level)
   // Read particles. Should be implemented
   std::string str = m_name + "_particles";
   readParticlesFromHDF(a_handle, m_photons[a_level], str);
+
+  // Read the random number stream counters. Older checkpoint files do not have these.
+  if (a_level == 0) {
+    HDF5HeaderData header;
+    header.readFromFile(a_handle);
+
+    if (header.m_int.find(m_name + "_stream_step") != header.m_int.end()) {
+      m_streamTimeStep = header.m_int[m_name + "_stream_step"];
+      m_streamPass     = header.m_int[m_name + "_stream_pass"];
+    }
+  }
 }
 #endif
 
@@ -882,10 +972,39 @@ McPhoto::domainBcMap(const int a_dir, const Side::LoHiSide a_side)
 }
 
 Real
-McPhoto::randomExponential(const Real a_mean) const noexcept
+McPhoto::randomExponential(const Real a_mean, RandomStream& a_stream) const noexcept
 {
-  std::exponential_distribution<Real> dist(a_mean);
-  return Random::get(dist);
+  return -std::log(a_stream.uniform01()) / a_mean;
+}
+
+uint64_t
+McPhoto::getNextStreamStep() const noexcept
+{
+  CH_assert(m_timeStep >= 0);
+
+  if (m_timeStep != m_streamTimeStep) {
+    m_streamTimeStep = m_timeStep;
+    m_streamPass     = 0;
+  }
+
+  CH_assert(m_streamPass < 65536);
+
+  const uint64_t streamStep = ((uint64_t)m_timeStep << 16) + (uint64_t)m_streamPass;
+
+  m_streamPass++;
+
+  return streamStep;
+}
+
+RandomStream
+McPhoto::getPatchStream(const uint64_t a_streamStep, const int a_level, const DataIndex& a_din) const noexcept
+{
+  const uint64_t streamID = Random::getPatchStreamID(Random::StreamConsumer::Photon,
+                                                     m_streamIndex,
+                                                     a_level,
+                                                     a_din.intCode());
+
+  return Random::getStream(a_streamStep, streamID);
 }
 
 void
@@ -905,6 +1024,9 @@ McPhoto::computeNumPhysicalPhotons(EBAMRCellData&       a_numPhysPhotonsTotal,
   CH_assert(a_dt >= 0.0);
 
   DataOps::setValue(a_numPhysPhotonsTotal, 0.0);
+  DataOps::setValue(a_numPhysPhotonsPacket, 0.0);
+
+  const uint64_t streamStep = this->getNextStreamStep();
 
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[lvl];
@@ -919,6 +1041,8 @@ McPhoto::computeNumPhysicalPhotons(EBAMRCellData&       a_numPhysPhotonsTotal,
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
+      RandomStream stream = this->getPatchStream(streamStep, lvl, din);
+
       const Box            cellBox    = dbl[din];
       const EBISBox&       ebisbox    = ebisl[din];
       const BaseFab<bool>& validCells = (*m_amr->getValidCells(m_realm)[lvl])[din];
@@ -935,7 +1059,7 @@ McPhoto::computeNumPhysicalPhotons(EBAMRCellData&       a_numPhysPhotonsTotal,
       auto regularKernel = [&](const IntVect& iv) -> void {
         if (ebisbox.isRegular(iv) && validCells(iv)) {
 
-          const size_t numPhysPhotons = this->drawPhotons(sourceReg(iv, 0), vol, a_dt);
+          const size_t numPhysPhotons = this->drawPhotons(sourceReg(iv, 0), vol, a_dt, stream);
           const size_t packetSize     = numPhysPhotons / m_numSamplingPackets;
           const size_t remainder      = numPhysPhotons % m_numSamplingPackets;
 
@@ -952,7 +1076,7 @@ McPhoto::computeNumPhysicalPhotons(EBAMRCellData&       a_numPhysPhotonsTotal,
         const IntVect iv = vof.gridIndex();
 
         if (ebisbox.isIrregular(iv) && validCells(iv)) {
-          const size_t numPhysPhotons = this->drawPhotons(source(vof, 0), vol, a_dt);
+          const size_t numPhysPhotons = this->drawPhotons(source(vof, 0), vol, a_dt, stream);
           const size_t packetSize     = numPhysPhotons / m_numSamplingPackets;
           const size_t remainder      = numPhysPhotons % m_numSamplingPackets;
 
@@ -974,7 +1098,7 @@ McPhoto::computeNumPhysicalPhotons(EBAMRCellData&       a_numPhysPhotonsTotal,
 }
 
 size_t
-McPhoto::drawPhotons(const Real a_source, const Real a_volume, const Real a_dt) const noexcept
+McPhoto::drawPhotons(const Real a_source, const Real a_volume, const Real a_dt, RandomStream& a_stream) const noexcept
 {
   CH_TIME("McPhoto::drawPhotons");
   if (m_verbosity > 5) {
@@ -1006,7 +1130,7 @@ McPhoto::drawPhotons(const Real a_source, const Real a_volume, const Real a_dt)
   // Draw a number of Photons with the desired algorithm
   if (m_photoGenerationMethod == PhotonGeneration::Stochastic) {
     const Real mean    = a_source * factor;
-    numPhysicalPhotons = Random::getPoisson<size_t>(mean);
+    numPhysicalPhotons = a_stream.poisson<size_t>(mean);
   }
   else if (m_photoGenerationMethod == PhotonGeneration::Deterministic) {
     numPhysicalPhotons = round(a_source * factor);
@@ -1030,6 +1154,10 @@ McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
 
   CH_assert(a_numPhysPhotons[0]->nComp() == 1);
 
+  // Photon directions and absorption lengths are drawn from one counter-based stream per grid patch, so that they do not depend
+  // on the OpenMP scheduling. The same holds for the transport functions below.
+  const uint64_t streamStep = this->getNextStreamStep();
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[lvl];
     const DataIterator&      dit    = dbl.dataIterator();
@@ -1043,6 +1171,8 @@ McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
+      RandomStream stream = this->getPatchStream(streamStep, lvl, din);
+
       const Box      cellBox = dbl[din];
       const EBISBox& ebisbox = ebisl[din];
 
@@ -1070,8 +1200,8 @@ McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
 
               // Determine starting position within cell, propagation direction, absorption
               // length, and weight.
-              const RealVect pos    = Random::randomPosition(lo, hi);
-              const RealVect v      = Units::c * Random::getDirection();
+              const RealVect pos    = Random::randomPosition(lo, hi, stream);
+              const RealVect v      = Units::c * stream.direction();
               const Real     weight = (Real)photonWeights[i];
               const Real     kappa  = m_rtSpecies->getAbsorptionCoefficient(pos);
 
@@ -1110,8 +1240,15 @@ McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
 
               // Determine starting position within cell, propagation direction, absorption
               // length, and weight.
-              const RealVect pos    = Random::randomPosition(cellPos, lo, hi, bndryCentroid, bndryNormal, dx, volFrac);
-              const RealVect v      = Units::c * Random::getDirection();
+              const RealVect pos    = Random::randomPosition(cellPos,
+                                                             lo,
+                                                             hi,
+                                                             bndryCentroid,
+                                                             bndryNormal,
+                                                             dx,
+                                                             volFrac,
+                                                             stream);
+              const RealVect v      = Units::c * stream.direction();
               const Real     weight = (Real)photonWeights[i];
 
               photons.add(Photon(pos, v, m_rtSpecies->getAbsorptionCoefficient(pos), weight));
@@ -1142,6 +1279,8 @@ McPhoto::dirtySamplePhotons(ParticleContainer<PointParticle>& a_photons,
 
   a_photons.clearParticles();
 
+  const uint64_t streamStep = this->getNextStreamStep();
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[lvl];
     const DataIterator&      dit    = dbl.dataIterator();
@@ -1155,6 +1294,8 @@ McPhoto::dirtySamplePhotons(ParticleContainer<PointParticle>& a_photons,
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
+      RandomStream stream = this->getPatchStream(streamStep, lvl, din);
+
       const Box      cellBox = dbl[din];
       const EBISBox& ebisbox = ebisl[din];
 
@@ -1182,10 +1323,10 @@ McPhoto::dirtySamplePhotons(ParticleContainer<PointParticle>& a_photons,
 
               // Determine starting position within cell, propagation direction, absorption
               // length, and weight.
-              const RealVect pos            = Random::randomPosition(lo, hi);
-              const RealVect direction      = Random::getDirection();
+              const RealVect pos            = Random::randomPosition(lo, hi, stream);
+              const RealVect direction      = stream.direction();
               const Real     kappa          = m_rtSpecies->getAbsorptionCoefficient(pos);
-              const Real     travelDistance = this->randomExponential(kappa);
+              const Real     travelDistance = this->randomExponential(kappa, stream);
               const RealVect finalPos       = pos + travelDistance * direction;
 
               photons.add(PointParticle(finalPos, (Real)photonWeights[i]));
@@ -1223,11 +1364,18 @@ McPhoto::dirtySamplePhotons(ParticleContainer<PointParticle>& a_photons,
 
               // Determine starting position within cell, propagation direction, absorption
               // length, and weight.
-              const RealVect pos = Random::randomPosition(cellPos, lo, hi, bndryCentroid, bndryNormal, dx, volFrac);
-              const RealVect direction      = Random::getDirection();
+              const RealVect pos            = Random::randomPosition(cellPos,
+                                                                     lo,
+                                                                     hi,
+                                                                     bndryCentroid,
+                                                                     bndryNormal,
+                                                                     dx,
+                                                                     volFrac,
+                                                                     stream);
+              const RealVect direction      = stream.direction();
               const Real     weight         = (Real)photonWeights[i];
               const Real     kappa          = m_rtSpecies->getAbsorptionCoefficient(pos);
-              const Real     travelDistance = this->randomExponential(kappa);
+              const Real     travelDistance = this->randomExponential(kappa, stream);
               const RealVect finalPos       = pos + travelDistance * direction;
 
               photons.add(PointParticle(finalPos, weight));
@@ -1420,16 +1568,21 @@ McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
 
   // TLDR: This routine iterates over the levels and boxes and does the following
   //
-  //       Forall photons in a_photons: {
-  //          1. Draw random absorption position
-  //          2. Determine if path intersected boundary, either EB or domain
-  //          3. Move the photon to appropriate data holder:
+  //       Forall packets of photons in a_photons: {
+  //          1. Draw random absorption positions
+  //          2. Determine which photons might have crossed a boundary, either EB or domain
+  //          3. Determine if those paths intersected the boundary
+  //          4. Move the photons to appropriate data holder:
   //                 Path crossed EB   => a_ebPhotons
   //                 Path cross domain => a_domainPhotons
   //                 Absorbed in bulk  => a_bulkPhotons
   //       }
   //
   //       Remap a_bulkPhotons, a_ebPhotons, a_domainPhotons
+  //
+  // The photons are transported in packets which are stored in a structure-of-arrays layout. The absorption positions and the
+  // cheap pre-tests for domain and EB intersections are computed for the whole packet at once, and only the photons that fail
+  // the pre-tests are subjected to the exact intersection tests.
 
   CH_START(t1);
   // Low and high corners
@@ -1441,13 +1594,19 @@ McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
   // a negligible safety factor to prevent that from happening.
   constexpr Real SAFETY = 1.E-6;
 
+  // Number of photons in each transport packet.
+  constexpr int PacketSize = 64;
+
   // This is the implicit function used for intersection tests
   const RefCountedPtr<BaseIF>& impFunc = m_computationalGeometry->getImplicitFunction(m_phase);
 
+  const uint64_t streamStep = this->getNextStreamStep();
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-    const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[lvl];
-    const DataIterator&      dit = dbl.dataIterator();
-    const Real               dx  = m_amr->getDx()[lvl];
+    const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[lvl];
+    const DataIterator&      dit   = dbl.dataIterator();
+    const EBISLayout&        ebisl = m_amr->getEBISLayout(m_realm, m_phase)[lvl];
+    const Real               dx    = m_amr->getDx()[lvl];
 
     const int nbox = dit.size();
 
@@ -1455,57 +1614,314 @@ McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
+      RandomStream stream = this->getPatchStream(streamStep, lvl, din);
+
+      const Box      cellBox = dbl[din];
+      const EBISBox& ebisbox = ebisl[din];
+
       List<Photon>& bulkPhotons = a_bulkPhotons[lvl][din].listItems();
       List<Photon>& ebPhotons   = a_ebPhotons[lvl][din].listItems();
       List<Photon>& domPhotons  = a_domainPhotons[lvl][din].listItems();
       List<Photon>& allPhotons  = a_photons[lvl][din].listItems();
 
-      // Iterate over the Photons that will be moved.
-      for (ListIterator<Photon> lit(allPhotons); lit.ok(); ++lit) {
-        Photon& p = lit();
+      // Physical extents of the grid patch. If the patch contains no cut-cells, i.e. the level-set does not cross zero inside it, a
+      // photon path that lies completely inside the patch can not have crossed the EB.
+      const bool     regularBox = m_patchTestEB && ebisbox.isAllRegular();
+      const RealVect boxLo      = probLo + dx * RealVect(cellBox.smallEnd());
+      const RealVect boxHi      = probLo + dx * RealVect(cellBox.bigEnd() + IntVect::Unit);
+
+      // Photon packet, stored in structure-of-arrays layout.
+      std::array<Photon*, PacketSize>                    packet;
+      std::array<std::array<Real, PacketSize>, SpaceDim> x0;
+      std::array<std::array<Real, PacketSize>, SpaceDim> x1;
+      std::array<Real, PacketSize>                       travelLength;
+      std::array<Real, PacketSize>                       velocityNorm;
+      std::array<bool, PacketSize>                       checkDom;
+      std::array<bool, PacketSize>                       checkEB;
+
+      // Kernel that transports a full or partially filled packet.
+      auto transportPacket = [&](const int a_numPhotons) -> void {
+        // Draw the propagation lengths. The uniform numbers for the whole packet are drawn in one batch from the patch stream.
+        stream.fillUniform01(travelLength.data(), a_numPhotons);
+        for (int i = 0; i < a_numPhotons; i++) {
+          travelLength[i] = -std::log(travelLength[i]) / packet[i]->kappa();
+        }
 
-        // Draw a new random absorption position
-        const RealVect& oldPos    = p.position();
-        const RealVect& direction = p.velocity() / (p.velocity().vectorLength());
-        const RealVect  newPos    = oldPos + direction * this->randomExponential(p.kappa());
+        // Gather the starting positions and velocities
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          for (int i = 0; i < a_numPhotons; i++) {
+            x0[dir][i] = packet[i]->position()[dir];
+            x1[dir][i] = packet[i]->velocity()[dir];
+          }
+        }
+
+        // Compute the absorption positions x1 = x0 + r * v/|v|.
+        for (int i = 0; i < a_numPhotons; i++) {
+          Real v2 = 0.0;
+          for (int dir = 0; dir < SpaceDim; dir++) {
+            v2 += x1[dir][i] * x1[dir][i];
+          }
+          velocityNorm[i] = sqrt(v2);
+        }
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          for (int i = 0; i < a_numPhotons; i++) {
+            x1[dir][i] = x0[dir][i] + (x1[dir][i] / velocityNorm[i]) * travelLength[i];
+          }
+        }
 
         // Check if we should check of different types of boundary intersections. These are cheap initial tests that allow
-        // us to skip intersection tests for some photons.
-        bool checkEB  = false;
-        bool checkDom = false;
+        // us to skip intersection tests for most photons.
+        for (int i = 0; i < a_numPhotons; i++) {
+          checkDom[i] = false;
+          checkEB[i]  = false;
+        }
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          for (int i = 0; i < a_numPhotons; i++) {
+            checkDom[i] = checkDom[i] || (x1[dir][i] < probLo[dir]) || (x1[dir][i] > probHi[dir]);
+          }
+        }
 
         if (!impFunc.isNull()) {
-          checkEB = true;
+          if (regularBox) {
+            for (int dir = 0; dir < SpaceDim; dir++) {
+              for (int i = 0; i < a_numPhotons; i++) {
+                checkEB[i] = checkEB[i] || (x0[dir][i] < boxLo[dir]) || (x0[dir][i] > boxHi[dir]) ||
+                             (x1[dir][i] < boxLo[dir]) || (x1[dir][i] > boxHi[dir]);
+              }
+            }
+          }
+          else {
+            for (int i = 0; i < a_numPhotons; i++) {
+              checkEB[i] = true;
+            }
+          }
         }
-        for (int dir = 0; dir < SpaceDim; dir++) {
-          if (newPos[dir] < probLo[dir] || newPos[dir] > probHi[dir]) {
-            checkDom = true;
+
+        // Move the photons to the appropriate data holders.
+        for (int i = 0; i < a_numPhotons; i++) {
+          Photon& p = *packet[i];
+
+          const RealVect oldPos(D_DECL(x0[0][i], x0[1][i], x0[2][i]));
+          const RealVect newPos(D_DECL(x1[0][i], x1[1][i], x1[2][i]));
+
+          if ((!checkEB[i] && !checkDom[i]) || m_transparentEB) {
+            p.position() = newPos;
+            bulkPhotons.add(p);
+          }
+          else {
+            // Must do an intersection test (with either EB or domain). These tests work such that we parametrize the photon path as
+            //
+            // x(s) = x0 + s*(x1-x0), s = [0,1]
+            //
+            // where x0 is the starting position (oldPos) and x1 is the new position (newPos).
+            //
+            // We determine s for the domain boundaries and EBs. If the photon path cross both, smallest s takes precedence.
+
+            Real sDom = std::numeric_limits<Real>::max();
+            Real sEB  = std::numeric_limits<Real>::max();
+
+            bool contactDomain = false;
+            bool contactEB     = false;
+
+            // Do intersection tests. These return true/false if the path crossed an object. If it returned true, the s-parameter
+            // will have been defined as well.
+            if (checkDom[i]) {
+              contactDomain = ParticleOps::domainIntersection(oldPos, newPos, probLo, probHi, sDom);
+            }
+
+            if (checkEB[i]) {
+              switch (m_intersectionEB) {
+              case IntersectionEB::Raycast: {
+                contactEB = ParticleOps::ebIntersectionRaycast(impFunc, oldPos, newPos, 1.E-3 * dx, sEB);
+
+                break;
+              }
+              case IntersectionEB::Bisection: {
+                contactEB = ParticleOps::ebIntersectionBisect(impFunc, oldPos, newPos, m_bisectStep, sEB);
+
+                break;
+              }
+              default: {
+                MayDay::Error("McPhoto::advancePhotonsInstantenous -- logic bust in eb intersection");
+
+                break;
+              }
+              }
+            }
+
+            // Move the photon to the appropriate data holder
+            if (!contactEB && !contactDomain) {
+              p.position() = newPos;
+              bulkPhotons.add(p);
+            }
+            else {
+              const RealVect path = newPos - oldPos;
+
+              if (sEB < sDom) {
+                p.position() = oldPos + sEB * path;
+
+                ebPhotons.add(p);
+              }
+              else {
+                p.position() = oldPos + std::max((Real)0.0, sDom - SAFETY) * path;
+
+                domPhotons.add(p);
+              }
+            }
           }
         }
+      };
 
-        if ((!checkEB && !checkDom) || m_transparentEB) {
-          p.position() = newPos;
-          bulkPhotons.add(p);
+      // Iterate over the photons that will be moved and transport them in packets.
+      int numPhotons = 0;
+      for (ListIterator<Photon> lit(allPhotons); lit.ok(); ++lit) {
+        packet[numPhotons] = &lit();
+
+        numPhotons++;
+
+        if (numPhotons == PacketSize) {
+          transportPacket(numPhotons);
+
+          numPhotons = 0;
         }
-        else {
-          // Must do an intersection test (with either EB or domain). These tests work such that we parametrize the photon path as
-          //
-          // x(s) = x0 + s*(x1-x0), s = [0,1]
-          //
-          // where x0 is the starting position (oldPos) and x1 is the new position (newPos).
-          //
-          // We determine s for the domain boundaries and EBs. If the photon path cross both, smallest s takes precedence.
+      }
+      if (numPhotons > 0) {
+        transportPacket(numPhotons);
+      }
+
+      // Everything will have been absorbed, but we used ::add rather than ::transfer, so just clear out the starting photons.
+      allPhotons.clear();
+    }
+  }
+  CH_STOP(t1);
+
+  // Need to remap because photons may/will have moved off the processor.
+  CH_START(t2);
+  a_bulkPhotons.remap();
+  a_ebPhotons.remap();
+  a_domainPhotons.remap();
+  CH_STOP(t2);
+}
+
+void
+McPhoto::advancePhotonsTrackLength(ParticleContainer<Photon>& a_bulkPhotons,
+                                   ParticleContainer<Photon>& a_ebPhotons,
+                                   ParticleContainer<Photon>& a_domainPhotons,
+                                   ParticleContainer<Photon>& a_photons)
+{
+  CH_TIMERS("McPhoto::advancePhotonsTrackLength");
+  CH_TIMER("McPhoto::advancePhotonsTrackLength::amr_loop", t1);
+  CH_TIMER("McPhoto::advancePhotonsTrackLength::remap", t2);
+  if (m_verbosity > 5) {
+    pout() << m_name + "::advancePhotonsTrackLength" << endl;
+  }
+
+  // TLDR: This routine iterates over the levels and boxes and does the following
+  //
+  //       Forall photons in a_photons: {
+  //          1. Compute the maximum path length, i.e. where the transmitted fraction of the photon weight is m_trackLengthTolerance.
+  //          2. Determine if path intersected boundary, either EB or domain, and truncate the path there.
+  //          3. Divide the path into segments and put a sub-photon carrying the expected absorbed weight in each segment in a_bulkPhotons
+  //          4. Put a photon carrying the transmitted weight in a_ebPhotons or a_domainPhotons if the path hit a boundary.
+  //          5. Otherwise, roulette the transmitted weight and repeat from the end of the path if the photon survives.
+  //       }
+  //
+  //       Remap a_bulkPhotons, a_ebPhotons, a_domainPhotons
+
+  CH_START(t1);
+  // Low and high corners
+  const RealVect probLo = m_amr->getProbLo();
+  const RealVect probHi = m_amr->getProbHi();
+
+  // Safety factor for photons that hit the domain boundary -- see advancePhotonsInstantaneous.
+  constexpr Real SAFETY = 1.E-6;
+
+  // This is the implicit function used for intersection tests
+  const RefCountedPtr<BaseIF>& impFunc = m_computationalGeometry->getImplicitFunction(m_phase);
+
+  const Real logTolerance = std::log(m_trackLengthTolerance);
+
+  const uint64_t streamStep = this->getNextStreamStep();
 
+  for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+    const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[lvl];
+    const DataIterator&      dit   = dbl.dataIterator();
+    const EBISLayout&        ebisl = m_amr->getEBISLayout(m_realm, m_phase)[lvl];
+    const Real               dx    = m_amr->getDx()[lvl];
+
+    const int nbox = dit.size();
+
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      RandomStream stream = this->getPatchStream(streamStep, lvl, din);
+
+      const Box      cellBox = dbl[din];
+      const EBISBox& ebisbox = ebisl[din];
+
+      List<Photon>& bulkPhotons = a_bulkPhotons[lvl][din].listItems();
+      List<Photon>& ebPhotons   = a_ebPhotons[lvl][din].listItems();
+      List<Photon>& domPhotons  = a_domainPhotons[lvl][din].listItems();
+      List<Photon>& allPhotons  = a_photons[lvl][din].listItems();
+
+      // Physical extents of the grid patch. Paths that lie completely inside a patch without cut-cells can not have crossed the EB.
+      const bool     regularBox = m_patchTestEB && ebisbox.isAllRegular();
+      const RealVect boxLo      = probLo + dx * RealVect(cellBox.smallEnd());
+      const RealVect boxHi      = probLo + dx * RealVect(cellBox.bigEnd() + IntVect::Unit);
+
+      for (ListIterator<Photon> lit(allPhotons); lit.ok(); ++lit) {
+        const Photon& p = lit();
+
+        const Real     kappa     = p.kappa();
+        const Real     weight    = p.weight();
+        const RealVect direction = p.velocity() / (p.velocity().vectorLength());
+
+        // Length of each tracked piece of the path.
+        const Real maxLength = -logTolerance / kappa;
+
+        // Track the photon in pieces of length maxLength. If a piece ends without hitting a boundary, the transmitted weight (the fraction
+        // m_trackLengthTolerance of the photon weight) is rouletted: with probability m_trackLengthTolerance the photon survives with its
+        // full weight and is tracked through another piece. This keeps the absorbed weight unbiased without depositing the tail weight in
+        // the last segment.
+        RealVect oldPos = p.position();
+        bool     track  = true;
+
+        while (track) {
+          const RealVect newPos = oldPos + maxLength * direction;
+
+          // Intersection tests, parametrizing the path as x(s) = x0 + s*(x1-x0), s = [0,1]. If the path crosses both the EB
+          // and the domain boundary, the smallest s takes precedence.
           Real sDom = std::numeric_limits<Real>::max();
           Real sEB  = std::numeric_limits<Real>::max();
 
           bool contactDomain = false;
           bool contactEB     = false;
 
-          // Do intersection tests. These return true/false if the path crossed an object. If it returned true, the s-parameter
-          // will have been defined as well.
+          // With transparent boundaries the paths are not clipped at either the EB or the domain boundary, which is the same
+          // as for the analog estimator.
+          bool checkDom = false;
+          bool checkEB  = !impFunc.isNull() && !m_transparentEB;
+
+          if (!m_transparentEB) {
+            for (int dir = 0; dir < SpaceDim; dir++) {
+              checkDom = checkDom || (newPos[dir] < probLo[dir]) || (newPos[dir] > probHi[dir]);
+            }
+          }
+
+          if (checkEB && regularBox) {
+            bool inside = true;
+            for (int dir = 0; dir < SpaceDim; dir++) {
+              inside = inside && (oldPos[dir] >= boxLo[dir]) && (oldPos[dir] <= boxHi[dir]);
+              inside = inside && (newPos[dir] >= boxLo[dir]) && (newPos[dir] <= boxHi[dir]);
+            }
+
+            checkEB = !inside;
+          }
+
           if (checkDom) {
             contactDomain = ParticleOps::domainIntersection(oldPos, newPos, probLo, probHi, sDom);
+            sDom          = contactDomain ? std::max((Real)0.0, sDom - SAFETY) : sDom;
           }
 
           if (checkEB) {
@@ -1521,36 +1937,60 @@ McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
               break;
             }
             default: {
-              MayDay::Error("McPhoto::advancePhotonsInstantenous -- logic bust in eb intersection");
+              MayDay::Error("McPhoto::advancePhotonsTrackLength -- logic bust in eb intersection");
 
               break;
             }
             }
           }
 
-          // Move the photon to the appropriate data holder
-          if (!contactEB && !contactDomain) {
-            p.position() = newPos;
-            bulkPhotons.add(p);
+          const bool hitBoundary = contactEB || contactDomain;
+          const Real sHit        = hitBoundary ? std::min((Real)1.0, std::min(sEB, sDom)) : 1.0;
+          const Real pathLength  = sHit * maxLength;
+
+          // Divide the path into segments no shorter than the grid resolution, and put the expected absorption in each segment into
+          // a sub-photon.
+          const int numCells = (int)std::ceil(pathLength / dx);
+
+          const int  numSegments = (pathLength > 0.0) ? std::max(1, std::min(m_trackLengthSegments, numCells)) : 0;
+          const Real segLength   = (numSegments > 0) ? pathLength / numSegments : 0.0;
+          const Real segAbsorb   = -std::expm1(-kappa * segLength);
+
+          for (int iseg = 0; iseg < numSegments; iseg++) {
+            const Real s0 = iseg * segLength;
+
+            const Real T0 = std::exp(-kappa * s0);
+            const Real T1 = T0 * (1.0 - segAbsorb);
+
+            // Absorption position within the segment, sampled from the exponential distribution restricted to the segment.
+            const Real u = stream.uniform01();
+            const Real s = s0 + std::min(segLength, -std::log1p(-u * segAbsorb) / kappa);
+
+            bulkPhotons.add(Photon(oldPos + s * direction, p.velocity(), kappa, weight * (T0 - T1)));
           }
-          else {
-            const RealVect path = newPos - oldPos;
 
-            if (sEB < sDom) {
-              p.position() = oldPos + sEB * path;
+          if (hitBoundary) {
+            // Photons that hit a boundary are absorbed there with the transmitted weight.
+            const Real     transmitted = weight * std::exp(-kappa * pathLength);
+            const RealVect hitPos      = oldPos + sHit * (newPos - oldPos);
 
-              ebPhotons.add(p);
+            if (sEB < sDom) {
+              ebPhotons.add(Photon(hitPos, p.velocity(), kappa, transmitted));
             }
             else {
-              p.position() = oldPos + std::max((Real)0.0, sDom - SAFETY) * path;
-
-              domPhotons.add(p);
+              domPhotons.add(Photon(hitPos, p.velocity(), kappa, transmitted));
             }
+
+            track = false;
+          }
+          else {
+            // Roulette the transmitted weight.
+            track  = stream.uniform01() < m_trackLengthTolerance;
+            oldPos = newPos;
           }
         }
       }
 
-      // Everything will have been absorbed, but we used ::add rather than ::transfer, so just clear out the starting photons.
       allPhotons.clear();
     }
   }
@@ -1602,6 +2042,8 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
   // This is the implicit function used for intersection tests
   const RefCountedPtr<BaseIF>& impFunc = m_computationalGeometry->getImplicitFunction(m_phase);
 
+  const uint64_t streamStep = this->getNextStreamStep();
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[lvl];
     const DataIterator&      dit = dbl.dataIterator();
@@ -1613,6 +2055,8 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
+      RandomStream stream = this->getPatchStream(streamStep, lvl, din);
+
       List<Photon>& bulkPhotons = a_bulkPhotons[lvl][din].listItems();
       List<Photon>& ebPhotons   = a_ebPhotons[lvl][din].listItems();
       List<Photon>& domPhotons  = a_domainPhotons[lvl][din].listItems();
@@ -1663,7 +2107,7 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
 
         // Check absorption in the bulk. We draw a propagation distance, if the photon propagates longer
         // than this distance the photon is absorbed.
-        const Real travelLen = this->randomExponential(p.kappa());
+        const Real travelLen = this->randomExponential(p.kappa(), stream);
         if (travelLen < pathLen) {
           absorbedBulk = true;
           sBulk        = travelLen / pathLen;
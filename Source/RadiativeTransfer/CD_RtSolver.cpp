@@ -26,9 +26,13 @@ RtSolver::RtSolver()
   CH_TIME("RtSolver::RtSolver");
 
   // Default settings
-  m_verbosity = -1;
-  m_name      = "RtSolver";
-  m_className = "RtSolver";
+  m_verbosity    = -1;
+  m_reportCycles = false;
+  m_numCycles    = -1;
+  m_timeStep     = 0;
+  m_streamIndex  = 0;
+  m_name         = "RtSolver";
+  m_className    = "RtSolver";
 }
 
 RtSolver::~RtSolver()
@@ -178,6 +182,19 @@ RtSolver::setTime(const int a_step, const Real a_time, const Real a_dt)
   m_dt       = a_dt;
 }
 
+void
+RtSolver::setStreamIndex(const int a_index) noexcept
+{
+  CH_TIME("RtSolver::setStreamIndex");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::setStreamIndex" << endl;
+  }
+
+  CH_assert(a_index >= 0);
+
+  m_streamIndex = a_index;
+}
+
 void
 RtSolver::setStationary(const bool a_stationary)
 {
@@ -440,6 +457,12 @@ RtSolver::getSpecies()
   return m_rtSpecies;
 }
 
+int
+RtSolver::getNumCycles() const noexcept
+{
+  return m_numCycles;
+}
+
 void
 RtSolver::parseVerbosity() noexcept
 {
@@ -453,6 +476,68 @@ RtSolver::parseVerbosity() noexcept
   pp.get("verbosity", m_verbosity);
 }
 
+void
+RtSolver::parseInitialGuess() noexcept
+{
+  CH_TIME("RtSolver::parseInitialGuess");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::parseInitialGuess" << endl;
+  }
+
+  ParmParse pp(m_className.c_str());
+
+  int historyLength = 0;
+
+  m_reportCycles = false;
+
+  pp.query("guess_history", historyLength);
+  pp.query("report_cycles", m_reportCycles);
+
+  if (historyLength == 1 || historyLength < 0) {
+    MayDay::Warning("RtSolver::parseInitialGuess - 'guess_history' must be 0 (off) or >= 2 (turning it off)");
+
+    historyLength = 0;
+  }
+
+  // Don't discard the stored solutions if the options are re-read with the same history length.
+  if (historyLength != m_solutionHistory.getMaxSize()) {
+    m_solutionHistory.define(historyLength);
+  }
+}
+
+bool
+RtSolver::extrapolateInitialGuess(EBAMRCellData& a_phi, const bool a_zeroPhi) noexcept
+{
+  CH_TIME("RtSolver::extrapolateInitialGuess");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::extrapolateInitialGuess" << endl;
+  }
+
+  bool extrapolated = false;
+
+  // Only the solver's own state has a history.
+  if (&a_phi == &m_phi && !a_zeroPhi) {
+    extrapolated = m_solutionHistory.extrapolate(a_phi, m_timeStep, m_time);
+  }
+
+  return extrapolated;
+}
+
+void
+RtSolver::storeSolution(const EBAMRCellData& a_phi) noexcept
+{
+  CH_TIME("RtSolver::storeSolution");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::storeSolution" << endl;
+  }
+
+  if (&a_phi == &m_phi) {
+    m_solutionHistory.store(a_phi, m_timeStep, m_time, [&](EBAMRCellData& a_data) -> void {
+      m_amr->allocate(a_data, m_realm, m_phase, m_nComp);
+    });
+  }
+}
+
 void
 RtSolver::computeLoads(Vector<long long>& a_loads, const DisjointBoxLayout& a_dbl, const int a_level) const noexcept
 {
@@ -12,11 +12,23 @@
 // Std includes
 #include <fstream>
 #include <sstream>
+#include <algorithm>
+#include <limits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 // Chombo includes
 #include <CH_Timer.H>
+#include <MayDay.H>
+#include <SPMD.H>
 #include <REAL.H>
 
+#ifdef CH_USE_HDF5
+#include <hdf5.h>
+#endif
+
 // Our includes
 #include <CD_DataParser.H>
 #include <CD_NamespaceHeader.H>
@@ -143,6 +155,59 @@ DataParser::fractionalFileReadASCII(const std::string       a_fileName,
   return returnTable;
 }
 
+LookupTable2D<Real>
+DataParser::simpleFileReadASCII2D(const std::string       a_fileName,
+                                  const int               a_xColumn,
+                                  const int               a_yColumn,
+                                  const int               a_fColumn,
+                                  const std::vector<char> a_ignoreChars)
+{
+  CH_TIME("DataParser::simpleFileReadASCII2D");
+
+  // This is the return table. It will be populated as we read the file.
+  LookupTable2D<Real> returnTable;
+
+  // Open an input file stream and start reading lines.
+  std::ifstream inputFile(a_fileName);
+  std::string   line;
+
+  while (std::getline(inputFile, line)) {
+
+    // Right trim line.
+    line.erase(line.find_last_not_of(" \n\r\t") + 1);
+
+    // Only do stuff for lines that are not empty. If we have an empty line we just proceed to the next one.
+    if (!line.empty()) {
+
+      // Check if we should parse the line. Lines starting with any of the comment symbols are not parsed.
+      bool parseThisLine = true;
+      for (const auto& ignoreChar : a_ignoreChars) {
+        if (line.at(0) == ignoreChar) {
+          parseThisLine = false;
+        }
+      }
+
+      if (parseThisLine) {
+        std::istringstream iss(line);
+
+        double              curVal;
+        std::vector<double> values;
+        while (iss >> curVal) {
+          values.emplace_back(curVal);
+        }
+
+        // Rows that do not have enough data are ignored.
+        const int numColumnsOnThisLine = values.size();
+        if (a_xColumn < numColumnsOnThisLine && a_yColumn < numColumnsOnThisLine && a_fColumn < numColumnsOnThisLine) {
+          returnTable.addData(values[a_xColumn], values[a_yColumn], values[a_fColumn]);
+        }
+      }
+    }
+  }
+
+  return returnTable;
+}
+
 List<PointParticle>
 DataParser::readPointParticlesASCII(const std::string       a_fileName,
                                     const unsigned int      a_xColumn,
@@ -201,8 +266,8 @@ DataParser::readPointParticlesASCII(const std::string       a_fileName,
 
           pos[0] = values[a_xColumn];
           pos[1] = values[a_yColumn];
-#if SpaceDim == 3
-          pos[1] = values[a_zColumn];
+#if CH_SPACEDIM == 3
+          pos[2] = values[a_zColumn];
 #endif
           weight = values[a_wColumn];
 
@@ -215,4 +280,346 @@ DataParser::readPointParticlesASCII(const std::string       a_fileName,
   return particles;
 }
 
+namespace {
+  /*!
+    @brief Get the rows [begin, end) that are read by a rank when N rows are split into contiguous chunks of (almost) equal size.
+    @param[in] a_numRows  Total number of rows
+    @param[in] a_rank     Rank
+    @param[in] a_numRanks Number of ranks
+  */
+  std::pair<long long, long long>
+  getRowRange(const long long a_numRows, const int a_rank, const int a_numRanks) noexcept
+  {
+    const long long equalChunk = a_numRows / a_numRanks;
+    const long long remainder  = a_numRows % a_numRanks;
+
+    const long long begin = a_rank * equalChunk + std::min((long long)a_rank, remainder);
+    const long long end   = begin + equalChunk + ((a_rank < remainder) ? 1 : 0);
+
+    return std::make_pair(begin, end);
+  }
+
+  /*!
+    @brief Convert row-major data to particles.
+    @param[inout] a_particles  Particles
+    @param[in]    a_data       Row-major data
+    @param[in]    a_numRows    Number of rows in a_data
+    @param[in]    a_numColumns Number of columns in a_data
+    @param[in]    a_xColumn    Column containing the x-coordinate
+    @param[in]    a_yColumn    Column containing the y-coordinate
+    @param[in]    a_zColumn    Column containing the z-coordinate
+    @param[in]    a_wColumn    Column containing the particle weight
+  */
+  void
+  addRowsAsParticles(List<PointParticle>& a_particles,
+                     const double*        a_data,
+                     const long long      a_numRows,
+                     const unsigned int   a_numColumns,
+                     const unsigned int   a_xColumn,
+                     const unsigned int   a_yColumn,
+                     const unsigned int   a_zColumn,
+                     const unsigned int   a_wColumn)
+  {
+    for (long long row = 0; row < a_numRows; row++) {
+      const double* values = a_data + row * a_numColumns;
+
+      RealVect pos;
+
+      pos[0] = values[a_xColumn];
+      pos[1] = values[a_yColumn];
+#if CH_SPACEDIM == 3
+      pos[2] = values[a_zColumn];
+#endif
+
+      a_particles.add(PointParticle(pos, values[a_wColumn]));
+    }
+  }
+
+  /*!
+    @brief Issue an error if one of the requested columns does not exist.
+    @param[in] a_caller     Calling function
+    @param[in] a_numColumns Number of columns in the data
+    @param[in] a_xColumn    Column containing the x-coordinate
+    @param[in] a_yColumn    Column containing the y-coordinate
+    @param[in] a_zColumn    Column containing the z-coordinate
+    @param[in] a_wColumn    Column containing the particle weight
+  */
+  void
+  checkColumns(const std::string  a_caller,
+               const unsigned int a_numColumns,
+               const unsigned int a_xColumn,
+               const unsigned int a_yColumn,
+               const unsigned int a_zColumn,
+               const unsigned int a_wColumn)
+  {
+    bool ok = a_xColumn < a_numColumns && a_yColumn < a_numColumns && a_wColumn < a_numColumns;
+#if CH_SPACEDIM == 3
+    ok = ok && a_zColumn < a_numColumns;
+#endif
+
+    if (!ok) {
+      const std::string err = a_caller + " - requested column exceeds the number of columns (" +
+                              std::to_string(a_numColumns) + ")";
+
+      MayDay::Error(err.c_str());
+    }
+  }
+} // namespace
+
+List<PointParticle>
+DataParser::scatterPointParticlesASCII(const std::string       a_fileName,
+                                       const unsigned int      a_xColumn,
+                                       const unsigned int      a_yColumn,
+                                       const unsigned int      a_zColumn,
+                                       const unsigned int      a_wColumn,
+                                       const std::vector<char> a_ignoreChars)
+{
+  CH_TIME("DataParser::scatterPointParticlesASCII");
+
+  List<PointParticle> particles;
+
+#ifdef CH_MPI
+  // TLDR: The master rank parses the file and packs the particles as rows of (x, y, z, w). The rows are then split into contiguous
+  //       chunks which are scattered to the ranks.
+  constexpr int numComp = SpaceDim + 1;
+
+  const int numRanks = numProc();
+
+  std::vector<double> sendBuffer;
+  std::vector<int>    sendCounts(numRanks, 0);
+  std::vector<int>    displacements(numRanks, 0);
+
+  if (procID() == 0) {
+    const List<PointParticle> allParticles =
+      DataParser::readPointParticlesASCII(a_fileName, a_xColumn, a_yColumn, a_zColumn, a_wColumn, a_ignoreChars);
+
+    const long long numParticles = allParticles.length();
+
+    if (numComp * numParticles > (long long)std::numeric_limits<int>::max()) {
+      MayDay::Error("DataParser::scatterPointParticlesASCII - too many particles, use a binary or HDF5 file instead");
+    }
+
+    sendBuffer.reserve(numComp * numParticles);
+
+    for (ListIterator<PointParticle> lit(allParticles); lit.ok(); ++lit) {
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        sendBuffer.emplace_back(lit().position()[dir]);
+      }
+      sendBuffer.emplace_back(lit().weight());
+    }
+
+    for (int rank = 0; rank < numRanks; rank++) {
+      const std::pair<long long, long long> rows = getRowRange(numParticles, rank, numRanks);
+
+      sendCounts[rank]    = numComp * (rows.second - rows.first);
+      displacements[rank] = numComp * rows.first;
+    }
+  }
+
+  int recvCount = 0;
+
+  MPI_Scatter(sendCounts.data(), 1, MPI_INT, &recvCount, 1, MPI_INT, 0, Chombo_MPI::comm);
+
+  std::vector<double> recvBuffer(recvCount);
+
+  MPI_Scatterv(sendBuffer.data(),
+               sendCounts.data(),
+               displacements.data(),
+               MPI_DOUBLE,
+               recvBuffer.data(),
+               recvCount,
+               MPI_DOUBLE,
+               0,
+               Chombo_MPI::comm);
+
+  addRowsAsParticles(particles, recvBuffer.data(), recvCount / numComp, numComp, 0, 1, SpaceDim - 1, SpaceDim);
+#else
+  particles =
+    DataParser::readPointParticlesASCII(a_fileName, a_xColumn, a_yColumn, a_zColumn, a_wColumn, a_ignoreChars);
+#endif
+
+  return particles;
+}
+
+List<PointParticle>
+DataParser::readPointParticlesBinary(const std::string  a_fileName,
+                                     const unsigned int a_numColumns,
+                                     const unsigned int a_xColumn,
+                                     const unsigned int a_yColumn,
+                                     const unsigned int a_zColumn,
+                                     const unsigned int a_wColumn)
+{
+  CH_TIME("DataParser::readPointParticlesBinary");
+
+  const std::string baseError = "DataParser::readPointParticlesBinary";
+
+  checkColumns(baseError, a_numColumns, a_xColumn, a_yColumn, a_zColumn, a_wColumn);
+
+  List<PointParticle> particles;
+
+  const int fileDescriptor = open(a_fileName.c_str(), O_RDONLY);
+
+  if (fileDescriptor < 0) {
+    const std::string err = baseError + " - could not open file '" + a_fileName + "'";
+
+    MayDay::Error(err.c_str());
+  }
+
+  struct stat fileStatus;
+  fstat(fileDescriptor, &fileStatus);
+
+  const long long fileSize = fileStatus.st_size;
+  const long long rowSize  = a_numColumns * sizeof(double);
+
+  if (fileSize % rowSize != 0) {
+    const std::string warn = baseError + " - file size is not a multiple of the row size, ignoring trailing bytes";
+
+    MayDay::Warning(warn.c_str());
+  }
+
+  const long long numRows = fileSize / rowSize;
+
+  const std::pair<long long, long long> rows = getRowRange(numRows, procID(), numProc());
+
+  const long long numLocalRows = rows.second - rows.first;
+
+  if (numLocalRows > 0) {
+
+    // Map only the part of the file that contains our rows. The mapping offset must be a multiple of the page size, so we start mapping at
+    // the page that contains the first row. Since the page size is a multiple of sizeof(double) the data is still properly aligned.
+    const long long pageSize   = sysconf(_SC_PAGESIZE);
+    const long long byteBegin  = rows.first * rowSize;
+    const long long byteEnd    = rows.second * rowSize;
+    const long long mapBegin   = (byteBegin / pageSize) * pageSize;
+    const size_t    mapLength  = byteEnd - mapBegin;
+    void*           mappedData = mmap(nullptr, mapLength, PROT_READ, MAP_PRIVATE, fileDescriptor, mapBegin);
+
+    if (mappedData == MAP_FAILED) {
+      const std::string err = baseError + " - could not memory-map file '" + a_fileName + "'";
+
+      MayDay::Error(err.c_str());
+    }
+
+    madvise(mappedData, mapLength, MADV_SEQUENTIAL);
+
+    const double* data = reinterpret_cast<const double*>(static_cast<const char*>(mappedData) + (byteBegin - mapBegin));
+
+    addRowsAsParticles(particles, data, numLocalRows, a_numColumns, a_xColumn, a_yColumn, a_zColumn, a_wColumn);
+
+    munmap(mappedData, mapLength);
+  }
+
+  close(fileDescriptor);
+
+  return particles;
+}
+
+#ifdef CH_USE_HDF5
+List<PointParticle>
+DataParser::readPointParticlesHDF5(const std::string  a_fileName,
+                                   const std::string  a_dataSet,
+                                   const unsigned int a_xColumn,
+                                   const unsigned int a_yColumn,
+                                   const unsigned int a_zColumn,
+                                   const unsigned int a_wColumn)
+{
+  CH_TIME("DataParser::readPointParticlesHDF5");
+
+  const std::string baseError = "DataParser::readPointParticlesHDF5";
+
+  List<PointParticle> particles;
+
+  // Set up file access and open the file.
+  hid_t fileAccess = H5P_DEFAULT;
+#ifdef CH_MPI
+  fileAccess = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(fileAccess, Chombo_MPI::comm, MPI_INFO_NULL);
+#endif
+
+  const hid_t fileID = H5Fopen(a_fileName.c_str(), H5F_ACC_RDONLY, fileAccess);
+
+#ifdef CH_MPI
+  H5Pclose(fileAccess);
+#endif
+
+  if (fileID < 0) {
+    const std::string err = baseError + " - could not open file '" + a_fileName + "'";
+
+    MayDay::Error(err.c_str());
+  }
+
+  const hid_t dataSetID = H5Dopen2(fileID, a_dataSet.c_str(), H5P_DEFAULT);
+
+  if (dataSetID < 0) {
+    const std::string err = baseError + " - could not open data set '" + a_dataSet + "' in file '" + a_fileName + "'";
+
+    MayDay::Error(err.c_str());
+  }
+
+  const hid_t fileSpaceID = H5Dget_space(dataSetID);
+
+  if (H5Sget_simple_extent_ndims(fileSpaceID) != 2) {
+    const std::string err = baseError + " - data set '" + a_dataSet + "' must be two-dimensional (rows x columns)";
+
+    MayDay::Error(err.c_str());
+  }
+
+  hsize_t dims[2];
+  H5Sget_simple_extent_dims(fileSpaceID, dims, nullptr);
+
+  const long long    numRows    = dims[0];
+  const unsigned int numColumns = dims[1];
+
+  checkColumns(baseError, numColumns, a_xColumn, a_yColumn, a_zColumn, a_wColumn);
+
+  const std::pair<long long, long long> rows = getRowRange(numRows, procID(), numProc());
+
+  const long long numLocalRows = rows.second - rows.first;
+
+  // Select our rows in the file and memory spaces. Ranks without any rows still participate in the collective read.
+  hsize_t fileStart[2] = {(hsize_t)rows.first, 0};
+  hsize_t fileCount[2] = {(hsize_t)numLocalRows, numColumns};
+  hsize_t memDims[2]   = {(hsize_t)std::max(numLocalRows, 1LL), numColumns};
+
+  const hid_t memSpaceID = H5Screate_simple(2, memDims, nullptr);
+
+  if (numLocalRows > 0) {
+    H5Sselect_hyperslab(fileSpaceID, H5S_SELECT_SET, fileStart, nullptr, fileCount, nullptr);
+  }
+  else {
+    H5Sselect_none(fileSpaceID);
+    H5Sselect_none(memSpaceID);
+  }
+
+  std::vector<double> data(numLocalRows * numColumns);
+
+  hid_t transfer = H5P_DEFAULT;
+#ifdef CH_MPI
+  transfer = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(transfer, H5FD_MPIO_COLLECTIVE);
+#endif
+
+  const herr_t err = H5Dread(dataSetID, H5T_NATIVE_DOUBLE, memSpaceID, fileSpaceID, transfer, data.data());
+
+#ifdef CH_MPI
+  H5Pclose(transfer);
+#endif
+
+  if (err < 0) {
+    const std::string str = baseError + " - could not read data set '" + a_dataSet + "' in file '" + a_fileName + "'";
+
+    MayDay::Error(str.c_str());
+  }
+
+  H5Sclose(memSpaceID);
+  H5Sclose(fileSpaceID);
+  H5Dclose(dataSetID);
+  H5Fclose(fileID);
+
+  addRowsAsParticles(particles, data.data(), numLocalRows, numColumns, a_xColumn, a_yColumn, a_zColumn, a_wColumn);
+
+  return particles;
+}
+#endif
+
 #include <CD_NamespaceFooter.H>
@@ -19,6 +19,7 @@ thread_local std::uniform_real_distribution<Real> Random::s_uniform11 = std::uni
 thread_local std::normal_distribution<Real>       Random::s_normal01  = std::normal_distribution<Real>(0.0, 1.0);
 
 bool Random::s_seeded = false;
+int  Random::s_seed   = 0;
 
 //std::once_flag once = std::once_flag();
 
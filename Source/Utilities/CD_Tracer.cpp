@@ -0,0 +1,340 @@
+/* chombo-discharge
+ * Copyright © 2024 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_Tracer.cpp
+  @brief  Implementation of CD_Tracer.H
+  @author Robert Marskar
+*/
+
+// Std includes
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <map>
+#include <set>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+
+// Chombo includes
+#include <SPMD.H>
+
+// Our includes
+#include <CD_Tracer.H>
+#include <CD_ParallelOps.H>
+#include <CD_NamespaceHeader.H>
+
+std::atomic<bool> Tracer::s_enabled(false);
+int64_t           Tracer::s_origin   = 0;
+size_t            Tracer::s_capacity = 65536;
+
+// Event registry and thread buffers. These are only touched under the mutex, i.e. when registering events, when a thread records
+// its first event, and when reading out the events.
+static std::mutex                                         s_tracerMutex;
+static std::vector<std::string>                           s_tracerEventNames;
+static std::map<std::string, Tracer::EventID>             s_tracerEventIDs;
+static std::vector<std::unique_ptr<Tracer::ThreadBuffer>> s_tracerBuffers;
+
+static thread_local Tracer::ThreadBuffer* s_tracerThreadBuffer = nullptr;
+
+Tracer::EventID
+Tracer::registerEvent(const std::string& a_name) noexcept
+{
+  std::lock_guard<std::mutex> lock(s_tracerMutex);
+
+  const auto it = s_tracerEventIDs.find(a_name);
+
+  if (it != s_tracerEventIDs.end()) {
+    return it->second;
+  }
+
+  const EventID id = s_tracerEventNames.size();
+
+  s_tracerEventNames.emplace_back(a_name);
+  s_tracerEventIDs.emplace(a_name, id);
+
+  return id;
+}
+
+void
+Tracer::enable(const bool a_enable) noexcept
+{
+  if (a_enable) {
+    Tracer::clear();
+
+    // Barrier so that all ranks have approximately the same time origin.
+    ParallelOps::barrier();
+
+    s_origin = Tracer::now();
+  }
+
+  s_enabled.store(a_enable, std::memory_order_relaxed);
+}
+
+void
+Tracer::setCapacity(const size_t a_capacity) noexcept
+{
+  std::lock_guard<std::mutex> lock(s_tracerMutex);
+
+  s_capacity = a_capacity;
+}
+
+void
+Tracer::clear() noexcept
+{
+  std::lock_guard<std::mutex> lock(s_tracerMutex);
+
+  for (auto& buffer : s_tracerBuffers) {
+    buffer->m_records.resize(s_capacity);
+    buffer->m_count = 0;
+  }
+}
+
+Tracer::ThreadBuffer*
+Tracer::getThreadBuffer() noexcept
+{
+  if (s_tracerThreadBuffer == nullptr) {
+    std::lock_guard<std::mutex> lock(s_tracerMutex);
+
+    std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer());
+
+    buffer->m_records.resize(s_capacity);
+    buffer->m_count  = 0;
+    buffer->m_depth  = 0;
+    buffer->m_thread = s_tracerBuffers.size();
+
+    s_tracerThreadBuffer = buffer.get();
+
+    s_tracerBuffers.emplace_back(std::move(buffer));
+  }
+
+  return s_tracerThreadBuffer;
+}
+
+std::vector<std::string>
+Tracer::getEventNames() noexcept
+{
+  std::lock_guard<std::mutex> lock(s_tracerMutex);
+
+  return s_tracerEventNames;
+}
+
+std::vector<Tracer::ThreadBuffer*>
+Tracer::getThreadBuffers() noexcept
+{
+  std::lock_guard<std::mutex> lock(s_tracerMutex);
+
+  std::vector<ThreadBuffer*> buffers;
+  for (const auto& buffer : s_tracerBuffers) {
+    buffers.emplace_back(buffer.get());
+  }
+
+  return buffers;
+}
+
+void
+Tracer::writeChromeTrace(const std::string& a_fileName) noexcept
+{
+  // TLDR: This writes the events in the Chrome trace event format, using complete events ("ph":"X") with timestamps and durations in
+  //       microseconds. Each MPI rank is a process and each thread is a thread in the trace. Events that were overwritten in the ring
+  //       buffers are lost, and the number of lost events is written as metadata.
+
+  const std::vector<std::string>   eventNames = Tracer::getEventNames();
+  const std::vector<ThreadBuffer*> buffers    = Tracer::getThreadBuffers();
+
+  const int rank = procID();
+
+  // Escape event names for JSON.
+  auto escape = [](const std::string& a_string) -> std::string {
+    std::string ret;
+    for (const char c : a_string) {
+      if (c == '"' || c == '\\') {
+        ret += '\\';
+      }
+      ret += c;
+    }
+
+    return ret;
+  };
+
+  std::ofstream f;
+  f.open(a_fileName, std::ios_base::trunc);
+
+  f << "{\"traceEvents\":[\n";
+  f << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"tid\":0,\"args\":{\"name\":\"rank " << rank
+    << "\"}}";
+
+  size_t droppedEvents = 0;
+
+  for (const auto& buffer : buffers) {
+    const size_t capacity = buffer->m_records.size();
+    const size_t count    = buffer->m_count;
+    const size_t first    = (count > capacity) ? count - capacity : 0;
+
+    droppedEvents += first;
+
+    f << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"tid\":" << buffer->m_thread
+      << ",\"args\":{\"name\":\"thread " << buffer->m_thread << "\"}}";
+
+    for (size_t i = first; i < count; i++) {
+      const Record& record = buffer->m_records[i % capacity];
+
+      const Real ts  = 1.E-3 * (record.m_begin - s_origin);
+      const Real dur = 1.E-3 * (record.m_end - record.m_begin);
+
+      f << ",\n{\"name\":\"" << escape(eventNames[record.m_id]) << "\",\"cat\":\"chombo-discharge\",\"ph\":\"X\",\"pid\":" << rank
+        << ",\"tid\":" << buffer->m_thread << std::fixed << std::setprecision(3) << ",\"ts\":" << ts << ",\"dur\":" << dur
+        << ",\"args\":{\"depth\":" << record.m_depth << "}}";
+    }
+  }
+
+  f << "\n],\n\"displayTimeUnit\":\"ns\",\n\"otherData\":{\"droppedEvents\":" << droppedEvents << "}}\n";
+
+  f.close();
+}
+
+void
+Tracer::report(std::ostream& a_outputStream) noexcept
+{
+  // TLDR: This computes the number of calls and the total time for each event on each thread. The per-rank numbers are then reduced
+  //       over the MPI ranks. Since the ranks might have registered different events (or registered them in a different order), we first
+  //       build the union of all event names and use that for indexing the reductions.
+
+  const std::vector<std::string>   eventNames = Tracer::getEventNames();
+  const std::vector<ThreadBuffer*> buffers    = Tracer::getThreadBuffers();
+
+  const size_t numLocalEvents = eventNames.size();
+
+  std::vector<long long> localCalls(numLocalEvents, 0);
+  std::vector<Real>      localTime(numLocalEvents, 0.0);
+  std::vector<Real>      threadMaxTime(numLocalEvents, 0.0);
+
+  for (const auto& buffer : buffers) {
+    const size_t capacity = buffer->m_records.size();
+    const size_t count    = buffer->m_count;
+    const size_t first    = (count > capacity) ? count - capacity : 0;
+
+    std::vector<Real> threadTime(numLocalEvents, 0.0);
+
+    for (size_t i = first; i < count; i++) {
+      const Record& record = buffer->m_records[i % capacity];
+
+      threadTime[record.m_id] += 1.E-9 * (record.m_end - record.m_begin);
+      localCalls[record.m_id] += 1;
+    }
+
+    for (size_t id = 0; id < numLocalEvents; id++) {
+      localTime[id] += threadTime[id];
+      threadMaxTime[id] = std::max(threadMaxTime[id], threadTime[id]);
+    }
+  }
+
+  // Union of all event names over the MPI ranks.
+  std::set<std::string> allNames(eventNames.begin(), eventNames.end());
+
+#ifdef CH_MPI
+  std::string packedNames;
+  for (const auto& name : eventNames) {
+    packedNames += name + '\n';
+  }
+
+  const int numRanks = numProc();
+  const int length   = packedNames.size();
+
+  std::vector<int> lengths(numRanks);
+  std::vector<int> displacements(numRanks, 0);
+
+  MPI_Allgather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, Chombo_MPI::comm);
+
+  for (int i = 1; i < numRanks; i++) {
+    displacements[i] = displacements[i - 1] + lengths[i - 1];
+  }
+
+  std::vector<char> recvBuffer(displacements[numRanks - 1] + lengths[numRanks - 1]);
+
+  MPI_Allgatherv(packedNames.data(),
+                 length,
+                 MPI_CHAR,
+                 recvBuffer.data(),
+                 lengths.data(),
+                 displacements.data(),
+                 MPI_CHAR,
+                 Chombo_MPI::comm);
+
+  std::string name;
+  for (const char c : recvBuffer) {
+    if (c == '\n') {
+      allNames.emplace(name);
+      name.clear();
+    }
+    else {
+      name += c;
+    }
+  }
+#endif
+
+  const std::vector<std::string> globalNames(allNames.begin(), allNames.end());
+  const size_t                   numGlobalEvents = globalNames.size();
+
+  std::vector<long long> calls(numGlobalEvents, 0);
+  std::vector<Real>      time(numGlobalEvents, 0.0);
+  std::vector<Real>      threadTime(numGlobalEvents, 0.0);
+
+  for (size_t id = 0; id < numLocalEvents; id++) {
+    const size_t globalID = std::lower_bound(globalNames.begin(), globalNames.end(), eventNames[id]) - globalNames.begin();
+
+    calls[globalID]      = localCalls[id];
+    time[globalID]       = localTime[id];
+    threadTime[globalID] = threadMaxTime[id];
+  }
+
+  std::vector<Real> minTime(time);
+  std::vector<Real> maxTime(time);
+  std::vector<Real> avgTime(time);
+
+#ifdef CH_MPI
+  MPI_Allreduce(MPI_IN_PLACE, minTime.data(), numGlobalEvents, MPI_CH_REAL, MPI_MIN, Chombo_MPI::comm);
+  MPI_Allreduce(MPI_IN_PLACE, maxTime.data(), numGlobalEvents, MPI_CH_REAL, MPI_MAX, Chombo_MPI::comm);
+  MPI_Allreduce(MPI_IN_PLACE, avgTime.data(), numGlobalEvents, MPI_CH_REAL, MPI_SUM, Chombo_MPI::comm);
+
+  for (auto& t : avgTime) {
+    t *= 1.0 / numRanks;
+  }
+#endif
+
+  std::stringstream ss;
+
+  const std::string line(124, '-');
+
+  ss << "| " << line << "|\n"
+     << "| Tracer report\n"
+     << "| " << line << "|\n"
+     << "| " << std::left << std::setw(48) << "Event"
+     << "| " << std::right << std::setw(10) << "Calls"
+     << "| " << std::right << std::setw(10) << "Loc. (s)"
+     << "| " << std::right << std::setw(10) << "Thr. (s)"
+     << "| " << std::right << std::setw(10) << "Min. (s)"
+     << "| " << std::right << std::setw(10) << "Avg. (s)"
+     << "| " << std::right << std::setw(10) << "Max. (s)"
+     << "|\n"
+     << "| " << line << "|\n";
+
+  for (size_t id = 0; id < numGlobalEvents; id++) {
+    ss << "| " << std::left << std::setw(48) << globalNames[id].substr(0, 47) << "| " << std::right << std::setw(10) << calls[id]
+       << std::fixed << std::setprecision(4) << "| " << std::right << std::setw(10) << time[id] << "| " << std::right
+       << std::setw(10) << threadTime[id] << "| " << std::right << std::setw(10) << minTime[id] << "| " << std::right
+       << std::setw(10) << avgTime[id] << "| " << std::right << std::setw(10) << maxTime[id] << "|\n";
+  }
+
+  ss << "| " << line << "|\n"
+     << "| Loc. = time on this rank (summed over threads), Thr. = maximum time on a thread on this rank\n"
+     << "| Min./Avg./Max. = minimum/average/maximum of Loc. over MPI ranks\n"
+     << "| " << line << "|\n";
+
+  a_outputStream << ss.str();
+}
+
+#include <CD_NamespaceFooter.H>